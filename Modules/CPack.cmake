@@ -304,8 +304,10 @@ installers.  The most commonly-used variables are:
 
   By default ``CPACK_THREADS`` is set to ``1``.
 
-  Currently only ``xz`` compression *may* take advantage of multiple cores.
-  Other compression methods ignore this value and use only one thread.
+  Currently only ``xz`` compression, and ``zstd`` compression when CMake
+  is built with libarchive 3.6 or higher, *may* take advantage of multiple
+  cores.  Other compression methods ignore this value and use only one
+  thread.
 
   .. versionadded:: 3.21
 
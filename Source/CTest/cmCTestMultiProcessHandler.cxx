@@ -840,13 +840,29 @@ void cmCTestMultiProcessHandler::CreateParallelTestCostList()
   // Remove the empty dependency level
   priorityStack.pop_back();
 
+  // Map each test to the tests that depend on it.
+  TestMap dependents;
+  for (auto const& t : this->Tests) {
+    for (int dep : t.second) {
+      dependents[dep].insert(t.first);
+    }
+  }
+  std::map<int, float> pathCosts;
+
   // Reverse iterate over the different dependency levels (deepest first).
-  // Sort tests within each level by COST and append them to the cost list.
+  // Sort tests within each level by the COST of the longest chain of tests
+  // they start, so that tests holding up long dependency chains run first,
+  // and append them to the cost list.
   for (TestSet const& currentSet : cmReverseRange(priorityStack)) {
     TestList sortedCopy;
     cm::append(sortedCopy, currentSet);
+    for (int test : sortedCopy) {
+      this->GetCriticalPathCost(test, dependents, pathCosts);
+    }
     std::stable_sort(sortedCopy.begin(), sortedCopy.end(),
-                     TestComparator(this));
+                     [&pathCosts](int index1, int index2) {
+                       return pathCosts[index1] > pathCosts[index2];
+                     });
 
     for (auto const& j : sortedCopy) {
       if (!cm::contains(alreadySortedTests, j)) {
@@ -857,6 +873,31 @@ void cmCTestMultiProcessHandler::CreateParallelTestCostList()
   }
 }
 
+float cmCTestMultiProcessHandler::GetCriticalPathCost(
+  int test, TestMap const& dependents, std::map<int, float>& pathCosts)
+{
+  auto const it = pathCosts.find(test);
+  if (it != pathCosts.end()) {
+    return it->second;
+  }
+
+  // Guard against revisiting this test through a dependency cycle.
+  float& pathCost = pathCosts[test];
+  pathCost = this->Properties[test]->Cost;
+
+  float longestDependent = 0;
+  auto const d = dependents.find(test);
+  if (d != dependents.end()) {
+    for (int dependent : d->second) {
+      longestDependent = std::max(
+        longestDependent,
+        this->GetCriticalPathCost(dependent, dependents, pathCosts));
+    }
+  }
+  pathCost += longestDependent;
+  return pathCost;
+}
+
 void cmCTestMultiProcessHandler::GetAllTestDependencies(int test,
                                                         TestList& dependencies)
 {
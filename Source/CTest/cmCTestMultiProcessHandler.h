@@ -119,6 +119,10 @@ protected:
   void CreateSerialTestCostList();
 
   void CreateParallelTestCostList();
+  // Return the cost of a test plus the most costly chain of tests
+  // that depend on it, memoized in pathCosts
+  float GetCriticalPathCost(int test, TestMap const& dependents,
+                            std::map<int, float>& pathCosts);
 
   // Removes the checkpoint file
   void MarkFinished();
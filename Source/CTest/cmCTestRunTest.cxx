@@ -2,6 +2,7 @@
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #include "cmCTestRunTest.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef> // IWYU pragma: keep
 #include <cstdint>
@@ -38,8 +39,12 @@ cmCTestRunTest::cmCTestRunTest(cmCTestMultiProcessHandler& multiHandler)
 
 void cmCTestRunTest::CheckOutput(std::string const& line)
 {
-  cmCTestLog(this->CTest, HANDLER_VERBOSE_OUTPUT,
-             this->GetIndex() << ": " << line << std::endl);
+  // Formatting the message for every line is expensive for tests with
+  // a lot of output, so skip it when it would not be shown anywhere.
+  if (this->CTest->GetExtraVerbose() || this->CTest->GetDebug()) {
+    cmCTestLog(this->CTest, HANDLER_VERBOSE_OUTPUT,
+               this->GetIndex() << ": " << line << std::endl);
+  }
 
   // Check for special CTest XML tags in this line of output.
   // If any are found, this line is excluded from ProcessOutput.
@@ -56,6 +61,12 @@ void cmCTestRunTest::CheckOutput(std::string const& line)
     }
   }
 
+  if (this->OutputSpoolLimit &&
+      this->ProcessOutput.size() > this->OutputSpoolLimit &&
+      this->SpoolOutput(line)) {
+    return;
+  }
+
   this->ProcessOutput += line;
   this->ProcessOutput += "\n";
 
@@ -81,9 +92,91 @@ void cmCTestRunTest::CheckOutput(std::string const& line)
   }
 }
 
+void cmCTestRunTest::SetupOutputSpool()
+{
+  this->RemoveOutputSpool();
+  this->OutputSpoolLimit = 0;
+
+  // Output is only truncated in the report when both limits are set, and
+  // anything matched against the whole output needs to keep all of it.
+  int const passedLimit = this->TestHandler->CustomMaximumPassedTestOutputSize;
+  int const failedLimit = this->TestHandler->CustomMaximumFailedTestOutputSize;
+  if (this->TestHandler->MemCheck || passedLimit <= 0 || failedLimit <= 0 ||
+      !this->TestProperties->RequiredRegularExpressions.empty() ||
+      !this->TestProperties->ErrorRegularExpressions.empty() ||
+      !this->TestProperties->SkipRegularExpressions.empty() ||
+      !this->TestProperties->TimeoutRegularExpressions.empty()) {
+    return;
+  }
+  this->OutputSpoolLimit =
+    static_cast<size_t>(std::max(passedLimit, failedLimit));
+  this->OutputSpoolFile =
+    cmStrCat(this->CTest->GetBinaryDir(), "/Testing/Temporary/TestOutput-",
+             this->Index, ".spool");
+}
+
+bool cmCTestRunTest::SpoolOutput(std::string const& line)
+{
+  if (!this->OutputSpoolUsed) {
+    this->OutputSpool.open(this->OutputSpoolFile.c_str(),
+                           std::ios::out | std::ios::binary);
+    if (!this->OutputSpool) {
+      // Keep the output in memory instead.
+      this->OutputSpool.clear();
+      this->OutputSpoolLimit = 0;
+      return false;
+    }
+    this->OutputSpoolUsed = true;
+  }
+  this->OutputSpool << line << '\n';
+
+  // These disable truncation or are processed from the whole output.
+  if (line.find("CTEST_FULL_OUTPUT") != std::string::npos ||
+      line.find("<DartMeasurement") != std::string::npos) {
+    this->OutputSpoolNeeded = true;
+  }
+  return true;
+}
+
+void cmCTestRunTest::LoadOutputSpool()
+{
+  if (!this->OutputSpoolUsed) {
+    return;
+  }
+  this->OutputSpool.close();
+  cmsys::ifstream fin(this->OutputSpoolFile.c_str(),
+                      std::ios::in | std::ios::binary);
+  if (fin) {
+    std::ostringstream spooled;
+    spooled << fin.rdbuf();
+    this->ProcessOutput += spooled.str();
+  }
+  fin.close();
+  this->RemoveOutputSpool();
+}
+
+void cmCTestRunTest::RemoveOutputSpool()
+{
+  if (this->OutputSpoolUsed) {
+    this->OutputSpool.close();
+    this->OutputSpool.clear();
+    cmSystemTools::RemoveFile(this->OutputSpoolFile);
+    this->OutputSpoolUsed = false;
+  }
+  this->OutputSpoolNeeded = false;
+}
+
 bool cmCTestRunTest::EndTest(size_t completed, size_t total, bool started)
 {
+  if (this->OutputSpoolUsed) {
+    this->OutputSpool.flush();
+  }
   this->WriteLogOutputTop(completed, total);
+  if (this->OutputSpoolNeeded ||
+      (this->OutputSpoolUsed &&
+       this->ProcessOutput.find("CTEST_FULL_OUTPUT") != std::string::npos)) {
+    this->LoadOutputSpool();
+  }
   std::string reason;
   bool passed = true;
   cmProcess::State res =
@@ -238,6 +331,7 @@ bool cmCTestRunTest::EndTest(size_t completed, size_t total, bool started)
   }
 
   if (outputTestErrorsToConsole) {
+    this->LoadOutputSpool();
     cmCTestLog(this->CTest, HANDLER_OUTPUT, this->ProcessOutput << std::endl);
   }
 
@@ -257,6 +351,7 @@ bool cmCTestRunTest::EndTest(size_t completed, size_t total, bool started)
           ? this->TestHandler->CustomMaximumPassedTestOutputSize
           : this->TestHandler->CustomMaximumFailedTestOutputSize));
   }
+  this->RemoveOutputSpool();
   this->TestResult.Reason = reason;
   if (this->TestHandler->LogFile) {
     bool pass = true;
@@ -508,6 +603,7 @@ bool cmCTestRunTest::StartTest(size_t completed, size_t total)
   }
 
   this->ProcessOutput.clear();
+  this->SetupOutputSpool();
 
   this->TestResult.Properties = this->TestProperties;
   this->TestResult.ExecutionTime = cmDuration::zero();
@@ -881,8 +977,15 @@ void cmCTestRunTest::WriteLogOutputTop(size_t completed, size_t total)
     << "Output:" << std::endl
     << "----------------------------------------------------------"
     << std::endl;
-  *this->TestHandler->LogFile << this->ProcessOutput << "<end of output>"
-                              << std::endl;
+  *this->TestHandler->LogFile << this->ProcessOutput;
+  if (this->OutputSpoolUsed) {
+    cmsys::ifstream fin(this->OutputSpoolFile.c_str(),
+                        std::ios::in | std::ios::binary);
+    if (fin) {
+      *this->TestHandler->LogFile << fin.rdbuf();
+    }
+  }
+  *this->TestHandler->LogFile << "<end of output>" << std::endl;
 
   if (!this->CTest->GetTestProgressOutput()) {
     cmCTestLog(this->CTest, HANDLER_OUTPUT, outputStream.str());
@@ -12,6 +12,8 @@
 
 #include <stddef.h>
 
+#include "cmsys/FStream.hxx"
+
 #include "cmCTest.h"
 #include "cmCTestMultiProcessHandler.h"
 #include "cmCTestTestHandler.h"
@@ -115,6 +117,11 @@ private:
                    std::vector<std::string>* environment,
                    std::vector<size_t>* affinity);
   void WriteLogOutputTop(size_t completed, size_t total);
+  // Spool output that exceeds what the test report keeps to a file
+  void SetupOutputSpool();
+  bool SpoolOutput(std::string const& line);
+  void LoadOutputSpool();
+  void RemoveOutputSpool();
   // Run post processing of the process output for MemCheck
   void MemCheckPostProcess();
 
@@ -130,6 +137,12 @@ private:
   cmCTest* CTest;
   std::unique_ptr<cmProcess> TestProcess;
   std::string ProcessOutput;
+  // Output after the first OutputSpoolLimit bytes, if spooling is enabled
+  size_t OutputSpoolLimit = 0;
+  std::string OutputSpoolFile;
+  cmsys::ofstream OutputSpool;
+  bool OutputSpoolUsed = false;
+  bool OutputSpoolNeeded = false;
   // The test results
   cmCTestTestHandler::cmCTestTestResult TestResult;
   cmCTestMultiProcessHandler& MultiTestHandler;
@@ -156,32 +156,11 @@ void cmCursesMainForm::RePost()
     this->Form = nullptr;
   }
   this->Fields.clear();
-  if (this->AdvancedMode) {
-    this->NumberOfVisibleEntries = this->Entries.size();
-  } else {
-    // If normal mode, count only non-advanced entries
-    this->NumberOfVisibleEntries = 0;
-    for (cmCursesCacheEntryComposite& entry : this->Entries) {
-      cmProp existingValue =
-        this->CMakeInstance->GetState()->GetCacheEntryValue(entry.GetValue());
-      bool advanced =
-        this->CMakeInstance->GetState()->GetCacheEntryPropertyAsBool(
-          entry.GetValue(), "ADVANCED");
-      if (!existingValue || (!this->AdvancedMode && advanced)) {
-        continue;
-      }
-      this->NumberOfVisibleEntries++;
-    }
-  }
-  // there is always one even if it is the dummy one
-  if (this->NumberOfVisibleEntries == 0) {
-    this->NumberOfVisibleEntries = 1;
-  }
   // Assign the fields: 3 for each entry: label, new entry marker
   // ('*' or ' ') and entry widget
-  this->Fields.reserve(3 * this->NumberOfVisibleEntries + 1);
+  this->Fields.reserve(3 * this->Entries.size() + 1);
 
-  // Assign fields
+  // Assign fields.  In normal mode, count only non-advanced entries.
   for (cmCursesCacheEntryComposite& entry : this->Entries) {
     cmProp existingValue =
       this->CMakeInstance->GetState()->GetCacheEntryValue(entry.GetValue());
@@ -195,6 +174,15 @@ void cmCursesMainForm::RePost()
     this->Fields.push_back(entry.IsNewLabel->Field);
     this->Fields.push_back(entry.Entry->Field);
   }
+  if (this->AdvancedMode) {
+    this->NumberOfVisibleEntries = this->Entries.size();
+  } else {
+    this->NumberOfVisibleEntries = this->Fields.size() / 3;
+  }
+  // there is always one even if it is the dummy one
+  if (this->NumberOfVisibleEntries == 0) {
+    this->NumberOfVisibleEntries = 1;
+  }
   // if no cache entries there should still be one dummy field
   if (this->Fields.empty()) {
     const auto& front = this->Entries.front();
@@ -86,6 +86,22 @@ struct cmArchiveWrite::Callback
   }
 };
 
+#if ARCHIVE_VERSION_NUMBER >= 3004000
+// Map the requested number of threads to a positive count: 0 means all
+// available cores, and a negative value -N means at most N cores.
+static int cmArchiveWriteThreadCount(int numThreads)
+{
+  if (numThreads < 1) {
+    int upperLimit = (numThreads == 0) ? std::numeric_limits<int>::max()
+                                       : std::abs(numThreads);
+
+    numThreads =
+      cm::clamp<int>(std::thread::hardware_concurrency(), 1, upperLimit);
+  }
+  return numThreads;
+}
+#endif
+
 cmArchiveWrite::cmArchiveWrite(std::ostream& os, Compress c,
                                std::string const& format, int compressionLevel,
                                int numThreads)
@@ -155,13 +171,7 @@ cmArchiveWrite::cmArchiveWrite(std::ostream& os, Compress c,
         // Upstream fixed an issue with their integer parsing in 3.4.0
         // which would cause spurious errors to be raised from `strtoull`.
 
-        if (numThreads < 1) {
-          int upperLimit = (numThreads == 0) ? std::numeric_limits<int>::max()
-                                             : std::abs(numThreads);
-
-          numThreads =
-            cm::clamp<int>(std::thread::hardware_concurrency(), 1, upperLimit);
-        }
+        numThreads = cmArchiveWriteThreadCount(numThreads);
 
 #  ifdef _AIX
         // FIXME: Using more than 2 threads creates an empty archive.
@@ -188,6 +198,23 @@ cmArchiveWrite::cmArchiveWrite(std::ostream& os, Compress c,
                                cm_archive_error_string(this->Archive));
         return;
       }
+
+#if ARCHIVE_VERSION_NUMBER >= 3006000
+      // Upstream added the zstd "threads" option in 3.6.0.
+      // It takes effect only if libzstd supports multi-threading.
+      if (numThreads != 1) {
+        std::string sNumThreads =
+          std::to_string(cmArchiveWriteThreadCount(numThreads));
+
+        if (archive_write_set_filter_option(this->Archive, "zstd", "threads",
+                                            sNumThreads.c_str()) !=
+            ARCHIVE_OK) {
+          this->Error = cmStrCat("archive_compressor_zstd_options: ",
+                                 cm_archive_error_string(this->Archive));
+          return;
+        }
+      }
+#endif
       break;
   }
 
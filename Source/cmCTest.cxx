@@ -3308,6 +3308,11 @@ bool cmCTest::GetExtraVerbose() const
   return this->Impl->ExtraVerbose;
 }
 
+bool cmCTest::GetDebug() const
+{
+  return this->Impl->Debug;
+}
+
 void cmCTest::SetStreams(std::ostream* out, std::ostream* err)
 {
   this->Impl->StreamOut = out;
@@ -420,6 +420,7 @@ public:
 
   bool GetVerbose() const;
   bool GetExtraVerbose() const;
+  bool GetDebug() const;
 
   /** Direct process output to given streams.  */
   void SetStreams(std::ostream* out, std::ostream* err);
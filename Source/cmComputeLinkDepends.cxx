@@ -627,10 +627,13 @@ void cmComputeLinkDepends::InferDependencies()
     // Intersect the sets for this item.
     DependSet common = sets.front();
     for (DependSet const& i : cmMakeRange(sets).advance(1)) {
+      if (common.empty()) {
+        break;
+      }
       DependSet intersection;
       std::set_intersection(common.begin(), common.end(), i.begin(), i.end(),
-                            std::inserter(intersection, intersection.begin()));
-      common = intersection;
+                            std::inserter(intersection, intersection.end()));
+      common = std::move(intersection);
     }
 
     // Add the inferred dependencies to the graph.
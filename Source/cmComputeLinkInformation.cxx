@@ -414,6 +414,12 @@ cmComputeLinkInformation::~cmComputeLinkInformation() = default;
 void cmComputeLinkInformation::AppendValues(
   std::string& result, std::vector<BT<std::string>>& values)
 {
+  std::string::size_type size = result.size() + 1;
+  for (BT<std::string> const& p : values) {
+    size += p.Value.size();
+  }
+  result.reserve(size);
+
   for (BT<std::string>& p : values) {
     if (result.empty()) {
       result.append(" ");
@@ -543,16 +543,17 @@ bool cmConditionEvaluator::HandleLevel2(cmArgumentList& newArgs,
         }
         const std::string& rex = argP2->GetValue();
         this->Makefile.ClearMatches();
-        cmsys::RegularExpression regEntry;
-        if (!regEntry.compile(rex)) {
+        cmsys::RegularExpression* regEntry =
+          this->Makefile.GetCompiledRegex(rex);
+        if (!regEntry) {
           std::ostringstream error;
           error << "Regular expression \"" << rex << "\" cannot compile";
           errorString = error.str();
           status = MessageType::FATAL_ERROR;
           return false;
         }
-        if (regEntry.find(*def)) {
-          this->Makefile.StoreMatches(regEntry);
+        if (regEntry->find(*def)) {
+          this->Makefile.StoreMatches(*regEntry);
           *arg = cmExpandedCommandArgument("1", true);
         } else {
           *arg = cmExpandedCommandArgument("0", true);
@@ -126,18 +126,21 @@ std::vector<unsigned char> cmCryptoHash::ByteHashFile(const std::string& file)
   if (fin) {
     this->Initialize();
     {
-      // Should be efficient enough on most system:
-      KWIML_INT_uint64_t buffer[512];
-      char* buffer_c = reinterpret_cast<char*>(buffer);
+      // Read in large blocks to keep the number of reads low for big
+      // files.  The stream buffer is bypassed for reads of this size.
+      std::vector<KWIML_INT_uint64_t> buffer(16384);
+      std::streamsize const bufferSize =
+        static_cast<std::streamsize>(buffer.size() * sizeof(buffer[0]));
+      char* buffer_c = reinterpret_cast<char*>(buffer.data());
       unsigned char const* buffer_uc =
-        reinterpret_cast<unsigned char const*>(buffer);
+        reinterpret_cast<unsigned char const*>(buffer.data());
       // This copy loop is very sensitive on certain platforms with
       // slightly broken stream libraries (like HPUX).  Normally, it is
       // incorrect to not check the error condition on the fin.read()
       // before using the data, but the fin.gcount() will be zero if an
       // error occurred.  Therefore, the loop should be safe everywhere.
       while (fin) {
-        fin.read(buffer_c, sizeof(buffer));
+        fin.read(buffer_c, bufferSize);
         if (int gcount = static_cast<int>(fin.gcount())) {
           this->Append(buffer_uc, gcount);
         }
@@ -11,13 +11,13 @@
 
 cmDefinitions::Def cmDefinitions::NoDef;
 
-cmDefinitions::Def const& cmDefinitions::GetInternal(const std::string& key,
+cmDefinitions::Def const& cmDefinitions::GetInternal(Key const& key,
                                                      StackIter begin,
                                                      StackIter end, bool raise)
 {
   assert(begin != end);
   {
-    auto it = begin->Map.find(cm::String::borrow(key));
+    auto it = begin->Map.find(key);
     if (it != begin->Map.end()) {
       return it->second;
     }
@@ -31,27 +31,31 @@ cmDefinitions::Def const& cmDefinitions::GetInternal(const std::string& key,
   if (!raise) {
     return def;
   }
-  return begin->Map.emplace(key, def).first->second;
+  // The lookup key may borrow its name, so store an owned copy.
+  return begin->Map.emplace(Key(cm::String(key.Name.view()), key.Hash), def)
+    .first->second;
 }
 
 const std::string* cmDefinitions::Get(const std::string& key, StackIter begin,
                                       StackIter end)
 {
-  Def const& def = cmDefinitions::GetInternal(key, begin, end, false);
+  Def const& def =
+    cmDefinitions::GetInternal(Key(cm::String::borrow(key)), begin, end, false);
   return def.Value ? def.Value.str_if_stable() : nullptr;
 }
 
 void cmDefinitions::Raise(const std::string& key, StackIter begin,
                           StackIter end)
 {
-  cmDefinitions::GetInternal(key, begin, end, true);
+  cmDefinitions::GetInternal(Key(cm::String::borrow(key)), begin, end, true);
 }
 
 bool cmDefinitions::HasKey(const std::string& key, StackIter begin,
                            StackIter end)
 {
+  Key const lookup(cm::String::borrow(key));
   for (StackIter it = begin; it != end; ++it) {
-    if (it->Map.find(cm::String::borrow(key)) != it->Map.end()) {
+    if (it->Map.find(lookup) != it->Map.end()) {
       return true;
     }
   }
@@ -67,11 +71,11 @@ cmDefinitions cmDefinitions::MakeClosure(StackIter begin, StackIter end)
     for (auto const& mi : it->Map) {
       // Use this key if it is not already set or unset.
       if (closure.Map.find(mi.first) == closure.Map.end() &&
-          undefined.find(mi.first.view()) == undefined.end()) {
+          undefined.find(mi.first.Name.view()) == undefined.end()) {
         if (mi.second.Value) {
           closure.Map.insert(mi);
         } else {
-          undefined.emplace(mi.first.view());
+          undefined.emplace(mi.first.Name.view());
         }
       }
     }
@@ -89,8 +93,8 @@ std::vector<std::string> cmDefinitions::ClosureKeys(StackIter begin,
     defined.reserve(defined.size() + it->Map.size());
     for (auto const& mi : it->Map) {
       // Use this key if it is not already set or unset.
-      if (bound.emplace(mi.first.view()).second && mi.second.Value) {
-        defined.push_back(*mi.first.str_if_stable());
+      if (bound.emplace(mi.first.Name.view()).second && mi.second.Value) {
+        defined.push_back(*mi.first.Name.str_if_stable());
       }
     }
   }
@@ -100,10 +104,10 @@ std::vector<std::string> cmDefinitions::ClosureKeys(StackIter begin,
 
 void cmDefinitions::Set(const std::string& key, cm::string_view value)
 {
-  this->Map[key] = Def(value);
+  this->Map[Key(key)] = Def(value);
 }
 
 void cmDefinitions::Unset(const std::string& key)
 {
-  this->Map[key] = Def();
+  this->Map[Key(key)] = Def();
 }
@@ -4,6 +4,7 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <cstddef>
 #include <functional>
 #include <string>
 #include <unordered_map>
@@ -61,8 +62,35 @@ private:
   };
   static Def NoDef;
 
-  std::unordered_map<cm::String, Def> Map;
+  /** Variable name with its hash computed once.  A lookup walks the
+      whole stack of scopes, so the key is hashed only once for all of
+      them.  */
+  struct Key
+  {
+    Key(cm::String name)
+      : Name(std::move(name))
+      , Hash(std::hash<cm::String>{}(this->Name))
+    {
+    }
+    Key(cm::String name, std::size_t hash)
+      : Name(std::move(name))
+      , Hash(hash)
+    {
+    }
+    cm::String Name;
+    std::size_t Hash;
+    friend bool operator==(Key const& l, Key const& r)
+    {
+      return l.Hash == r.Hash && l.Name == r.Name;
+    }
+  };
+  struct KeyHash
+  {
+    std::size_t operator()(Key const& key) const { return key.Hash; }
+  };
+
+  std::unordered_map<Key, Def, KeyHash> Map;
 
-  static Def const& GetInternal(const std::string& key, StackIter begin,
+  static Def const& GetInternal(Key const& key, StackIter begin,
                                 StackIter end, bool raise);
 };
@@ -7,6 +7,7 @@
 #include "cmsys/FStream.hxx"
 
 #include "cmFileTime.h"
+#include "cmFileTimeCache.h"
 #include "cmGlobalUnixMakefileGenerator3.h"
 #include "cmLocalUnixMakefileGenerator3.h"
 #include "cmMakefile.h"
@@ -63,8 +64,6 @@ cmDependsC::cmDependsC(cmLocalUnixMakefileGenerator3* lg,
 
   this->CacheFileName =
     cmStrCat(this->TargetDirectory, '/', lang, ".includecache");
-
-  this->ReadCacheFile();
 }
 
 cmDependsC::~cmDependsC()
@@ -87,6 +86,13 @@ bool cmDependsC::WriteDependencies(const std::set<std::string>& sources,
     return false;
   }
 
+  // Load the include cache on first use so that it can share file
+  // times already loaded by the dependency check.
+  if (!this->CacheFileLoaded) {
+    this->CacheFileLoaded = true;
+    this->ReadCacheFile();
+  }
+
   std::set<std::string> dependencies;
   bool haveDeps = false;
 
@@ -266,7 +272,9 @@ void cmDependsC::ReadCacheFile()
       haveFileName = true;
 
       cmFileTime fileTime;
-      bool const res = cacheFileTimeGood && fileTime.Load(line);
+      bool const res = cacheFileTimeGood &&
+        (this->FileTimeCache ? this->FileTimeCache->Load(line, fileTime)
+                             : fileTime.Load(line));
       bool const newer = res && cacheFileTime.Newer(fileTime);
 
       if (res && newer) // cache is newer than the parsed file
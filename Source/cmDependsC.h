@@ -88,6 +88,7 @@ protected:
   std::map<std::string, std::string> HeaderLocationCache;
 
   std::string CacheFileName;
+  bool CacheFileLoaded = false;
 
   void WriteCacheFile() const;
   void ReadCacheFile();
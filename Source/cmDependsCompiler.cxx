@@ -4,6 +4,7 @@
 #include "cmDependsCompiler.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -34,11 +35,31 @@ bool cmDependsCompiler::CheckDependencies(
   bool forceReadDeps = true;
 
   cmFileTime internalDepFileTime;
-  // read cached dependencies stored in internal file
-  if (cmSystemTools::FileExists(internalDepFile)) {
-    internalDepFileTime.Load(internalDepFile);
+  if (internalDepFileTime.Load(internalDepFile)) {
     forceReadDeps = false;
+  }
+
+  // Find the compiler generated dependencies files that are newer
+  // than the cached dependencies.  If there are none, the cached
+  // dependencies are up to date and do not need to be read at all.
+  std::vector<std::size_t> newerDepFiles;
+  cmFileTime depFileTime;
+  for (std::size_t i = 0; i + 3 < depFiles.size(); i += 4) {
+    const auto& depFile = depFiles[i + 3];
+
+    if (!depFileTime.Load(depFile)) {
+      continue;
+    }
+    if (forceReadDeps || depFileTime.Compare(internalDepFileTime) >= 0) {
+      newerDepFiles.push_back(i);
+    }
+  }
+  if (newerDepFiles.empty()) {
+    return status;
+  }
 
+  // read cached dependencies stored in internal file
+  if (!forceReadDeps) {
     // read current dependencies
     cmsys::ifstream fin(internalDepFile.c_str());
     if (fin) {
@@ -73,106 +94,98 @@ bool cmDependsCompiler::CheckDependencies(
 
   // Now, update dependencies map with all new compiler generated
   // dependencies files
-  cmFileTime depFileTime;
-  for (auto dep = depFiles.begin(); dep != depFiles.end(); dep++) {
-    const auto& source = *dep++;
-    const auto& target = *dep++;
-    const auto& format = *dep++;
-    const auto& depFile = *dep;
+  cmGccDepfilePathCache pathCache;
+  for (std::size_t i : newerDepFiles) {
+    const auto& source = depFiles[i];
+    const auto& target = depFiles[i + 1];
+    const auto& format = depFiles[i + 2];
+    const auto& depFile = depFiles[i + 3];
 
-    if (!cmSystemTools::FileExists(depFile)) {
-      continue;
+    status = false;
+    if (this->Verbose) {
+      cmSystemTools::Stdout(cmStrCat("Dependencies file \"", depFile,
+                                     "\" is newer than depends file \"",
+                                     internalDepFile, "\".\n"));
     }
 
-    if (!forceReadDeps) {
-      depFileTime.Load(depFile);
-    }
-    if (forceReadDeps || depFileTime.Compare(internalDepFileTime) >= 0) {
-      status = false;
-      if (this->Verbose) {
-        cmSystemTools::Stdout(cmStrCat("Dependencies file \"", depFile,
-                                       "\" is newer than depends file \"",
-                                       internalDepFile, "\".\n"));
+    std::vector<std::string> depends;
+    if (format == "custom"_s) {
+      auto deps = cmReadGccDepfile(
+        depFile.c_str(), this->LocalGenerator->GetCurrentBinaryDirectory(),
+        &pathCache);
+      if (!deps) {
+        continue;
       }
 
-      std::vector<std::string> depends;
-      if (format == "custom"_s) {
-        auto deps = cmReadGccDepfile(
-          depFile.c_str(), this->LocalGenerator->GetCurrentBinaryDirectory());
-        if (!deps) {
+      for (auto& entry : *deps) {
+        depends = std::move(entry.paths);
+        if (isValidPath) {
+          cm::erase_if(depends, isValidPath);
+        }
+        // copy depends for each target, except first one, which can be
+        // moved
+        for (auto index = entry.rules.size() - 1; index > 0; --index) {
+          dependencies[entry.rules[index]] = depends;
+        }
+        dependencies[entry.rules.front()] = std::move(depends);
+      }
+    } else {
+      if (format == "msvc"_s) {
+        cmsys::ifstream fin(depFile.c_str());
+        if (!fin) {
           continue;
         }
 
-        for (auto& entry : *deps) {
-          depends = std::move(entry.paths);
-          if (isValidPath) {
-            cm::erase_if(depends, isValidPath);
-          }
-          // copy depends for each target, except first one, which can be
-          // moved
-          for (auto index = entry.rules.size() - 1; index > 0; --index) {
-            dependencies[entry.rules[index]] = depends;
-          }
-          dependencies[entry.rules.front()] = std::move(depends);
+        std::string line;
+        if (!isValidPath) {
+          // insert source as first dependency
+          depends.push_back(source);
+        }
+        while (cmSystemTools::GetLineFromStream(fin, line)) {
+          depends.emplace_back(std::move(line));
+        }
+      } else if (format == "gcc"_s) {
+        auto deps = cmReadGccDepfile(depFile.c_str(), {}, &pathCache);
+        if (!deps) {
+          continue;
         }
-      } else {
-        if (format == "msvc"_s) {
-          cmsys::ifstream fin(depFile.c_str());
-          if (!fin) {
-            continue;
-          }
-
-          std::string line;
-          if (!isValidPath) {
-            // insert source as first dependency
-            depends.push_back(source);
-          }
-          while (cmSystemTools::GetLineFromStream(fin, line)) {
-            depends.emplace_back(std::move(line));
-          }
-        } else if (format == "gcc"_s) {
-          auto deps = cmReadGccDepfile(depFile.c_str());
-          if (!deps) {
-            continue;
-          }
-
-          // dependencies generated by the compiler contains only one target
-          depends = std::move(deps->front().paths);
-          if (depends.empty()) {
-            // unexpectedly empty, ignore it and continue
-            continue;
-          }
-
-          // depending of the effective format of the dependencies file
-          // generated by the compiler, the target can be wrongly identified
-          // as a dependency so remove it from the list
-          if (depends.front() == target) {
-            depends.erase(depends.begin());
-          }
 
-          // ensure source file is the first dependency
-          if (depends.front() != source) {
-            cm::erase(depends, source);
-            if (!isValidPath) {
-              depends.insert(depends.begin(), source);
-            }
-          } else if (isValidPath) {
-            // remove first dependency because it must not be filtered out
-            depends.erase(depends.begin());
-          }
-        } else {
-          // unknown format, ignore it
+        // dependencies generated by the compiler contains only one target
+        depends = std::move(deps->front().paths);
+        if (depends.empty()) {
+          // unexpectedly empty, ignore it and continue
           continue;
         }
 
-        if (isValidPath) {
-          cm::erase_if(depends, isValidPath);
-          // insert source as first dependency
-          depends.insert(depends.begin(), source);
+        // depending of the effective format of the dependencies file
+        // generated by the compiler, the target can be wrongly identified
+        // as a dependency so remove it from the list
+        if (depends.front() == target) {
+          depends.erase(depends.begin());
         }
 
-        dependencies[target] = std::move(depends);
+        // ensure source file is the first dependency
+        if (depends.front() != source) {
+          cm::erase(depends, source);
+          if (!isValidPath) {
+            depends.insert(depends.begin(), source);
+          }
+        } else if (isValidPath) {
+          // remove first dependency because it must not be filtered out
+          depends.erase(depends.begin());
+        }
+      } else {
+        // unknown format, ignore it
+        continue;
       }
+
+      if (isValidPath) {
+        cm::erase_if(depends, isValidPath);
+        // insert source as first dependency
+        depends.insert(depends.begin(), source);
+      }
+
+      dependencies[target] = std::move(depends);
     }
   }
 
@@ -2,14 +2,20 @@
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #include "cmDependsFortran.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "cmsys/FStream.hxx"
 
+#include "cmFileTime.h"
+#include "cmFileTimeCache.h"
 #include "cmFortranParser.h" /* Interface to parser object.  */
 #include "cmGeneratedFileStream.h"
 #include "cmGlobalUnixMakefileGenerator3.h"
@@ -40,9 +46,26 @@ static void cmFortranModuleAppendUpperLower(std::string const& mod,
   mod_lower += mod;
 }
 
+/** Scan result of one object file, with the modification times of
+    every file that was read to produce it and the include file lookups
+    that selected those files.  */
+struct cmDependsFortranScanEntry
+{
+  std::map<std::string, cmFileTime::TimeType> Sources;
+  std::map<std::string, cmFileTime::TimeType> Includes;
+  std::vector<cmFortranIncludeLookup> Lookups;
+  cmFortranSourceInfo Info;
+};
+
 class cmDependsFortranInternals
 {
 public:
+  // Scan results of the previous run, and of this run, by object file.
+  using ScanCacheMap = std::map<std::string, cmDependsFortranScanEntry>;
+  ScanCacheMap ScanCache;
+  ScanCacheMap ScanResults;
+  bool ScanCacheLoaded = false;
+
   // The set of modules provided by this target.
   std::set<std::string> TargetProvides;
 
@@ -119,7 +142,21 @@ bool cmDependsFortran::WriteDependencies(const std::set<std::string>& sources,
   fc.SModSep = this->SModSep;
   fc.SModExt = this->SModExt;
 
+  // Reuse the previous scan result if none of its inputs changed.
+  if (!this->Internal->ScanCacheLoaded) {
+    this->Internal->ScanCacheLoaded = true;
+    this->LoadScanCache();
+  }
+  auto cached = this->Internal->ScanCache.find(obj);
+  if (cached != this->Internal->ScanCache.end() &&
+      this->ScanEntryUpToDate(sources, cached->second)) {
+    this->Internal->ObjectInfo[obj] = cached->second.Info;
+    this->Internal->ScanResults[obj] = std::move(cached->second);
+    return true;
+  }
+
   bool okay = true;
+  std::vector<cmFortranIncludeLookup> lookups;
   for (std::string const& src : sources) {
     // Get the information object for this source.
     cmFortranSourceInfo& info = this->Internal->CreateObjectInfo(obj, src);
@@ -142,10 +179,217 @@ bool cmDependsFortran::WriteDependencies(const std::set<std::string>& sources,
         ;
       /* clang-format on */
     }
+
+    std::move(parser.IncludeLookups.begin(), parser.IncludeLookups.end(),
+              std::back_inserter(lookups));
+  }
+
+  if (okay && this->FileTimeCache) {
+    cmDependsFortranScanEntry entry;
+    entry.Info = this->Internal->ObjectInfo[obj];
+    entry.Lookups = std::move(lookups);
+    cmFileTime ft;
+    for (std::string const& src : sources) {
+      if (!this->FileTimeCache->Load(src, ft)) {
+        return okay;
+      }
+      entry.Sources[src] = ft.GetTime();
+    }
+    for (std::string const& inc : entry.Info.Includes) {
+      if (!this->FileTimeCache->Load(inc, ft)) {
+        return okay;
+      }
+      entry.Includes[inc] = ft.GetTime();
+    }
+    this->Internal->ScanResults[obj] = std::move(entry);
   }
   return okay;
 }
 
+std::vector<std::string> cmDependsFortran::GetScanCacheSettings() const
+{
+  // Everything other than file content that affects scan results.
+  std::vector<std::string> settings;
+  settings.emplace_back(cmStrCat("compiler-id ", this->CompilerId));
+  settings.emplace_back(cmStrCat("smod-sep ", this->SModSep));
+  settings.emplace_back(cmStrCat("smod-ext ", this->SModExt));
+  for (std::string const& dir : this->IncludePath) {
+    settings.emplace_back(cmStrCat("include-dir ", dir));
+  }
+  for (std::string const& def : this->PPDefinitions) {
+    settings.emplace_back(cmStrCat("define ", def));
+  }
+  return settings;
+}
+
+void cmDependsFortran::LoadScanCache()
+{
+  if (this->FileTimeCache == nullptr) {
+    return;
+  }
+  std::string fsName = cmStrCat(this->TargetDirectory, "/fortran.scan");
+  cmsys::ifstream fin(fsName.c_str());
+  if (!fin) {
+    return;
+  }
+
+  std::vector<std::string> settings;
+  cmDependsFortranInternals::ScanCacheMap entries;
+  cmDependsFortranScanEntry* entry = nullptr;
+  std::string line;
+  while (cmSystemTools::GetLineFromStream(fin, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::string::size_type pos = line.find(' ');
+    if (pos == std::string::npos) {
+      return;
+    }
+    std::string const key = line.substr(0, pos);
+    std::string value = line.substr(pos + 1);
+    if (key == "object") {
+      entry = &entries[value];
+      continue;
+    }
+    if (!entry) {
+      settings.emplace_back(std::move(line));
+      continue;
+    }
+    if (key == "source" || key == "include") {
+      std::string::size_type tpos = value.find(' ');
+      if (tpos == std::string::npos) {
+        return;
+      }
+      cmFileTime::TimeType const time =
+        std::strtoll(value.c_str(), nullptr, 10);
+      std::string path = value.substr(tpos + 1);
+      if (key == "source") {
+        if (entry->Info.Source.empty()) {
+          entry->Info.Source = path;
+        }
+        entry->Sources[std::move(path)] = time;
+      } else {
+        entry->Info.Includes.insert(path);
+        entry->Includes[std::move(path)] = time;
+      }
+    } else if (key == "lookup-dir" || key == "lookup-line") {
+      entry->Lookups.emplace_back();
+      cmFortranIncludeLookup& lookup = entry->Lookups.back();
+      if (key == "lookup-dir") {
+        lookup.Directory = std::move(value);
+      } else {
+        lookup.Name = std::move(value);
+        lookup.LineDirective = true;
+      }
+    } else if (key == "lookup-name" || key == "lookup-found") {
+      if (entry->Lookups.empty()) {
+        return;
+      }
+      cmFortranIncludeLookup& lookup = entry->Lookups.back();
+      if (key == "lookup-name") {
+        lookup.Name = std::move(value);
+      } else {
+        lookup.Found = std::move(value);
+      }
+    } else if (key == "provides") {
+      entry->Info.Provides.insert(std::move(value));
+    } else if (key == "requires") {
+      entry->Info.Requires.insert(std::move(value));
+    } else {
+      return;
+    }
+  }
+
+  // Results scanned with different settings cannot be reused.
+  if (settings == this->GetScanCacheSettings()) {
+    this->Internal->ScanCache = std::move(entries);
+  }
+}
+
+bool cmDependsFortran::ScanEntryUpToDate(
+  std::set<std::string> const& sources,
+  cmDependsFortranScanEntry const& entry) const
+{
+  if (sources.size() != entry.Sources.size()) {
+    return false;
+  }
+  auto upToDate =
+    [this](std::pair<std::string const, cmFileTime::TimeType> const& f) {
+      cmFileTime ft;
+      return this->FileTimeCache->Load(f.first, ft) &&
+        ft.GetTime() == f.second;
+    };
+  for (std::string const& src : sources) {
+    auto i = entry.Sources.find(src);
+    if (i == entry.Sources.end() || !upToDate(*i)) {
+      return false;
+    }
+  }
+  for (auto const& inc : entry.Includes) {
+    if (!upToDate(inc)) {
+      return false;
+    }
+  }
+
+  // Repeat each include file lookup.  A file added since the last scan
+  // may now be found in place of the one that was read, or where none
+  // was found before, without any recorded file having changed.
+  std::string found;
+  for (cmFortranIncludeLookup const& lookup : entry.Lookups) {
+    found.clear();
+    if (lookup.LineDirective) {
+      if (cmSystemTools::FileExists(lookup.Name, true)) {
+        found = lookup.Name;
+      }
+    } else if (!cmFortranParser_s::FindIncludeFile(
+                 this->IncludePath, lookup.Directory.c_str(),
+                 lookup.Name.c_str(), found)) {
+      found.clear();
+    }
+    if (found != lookup.Found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void cmDependsFortran::WriteScanCache()
+{
+  std::string fsName = cmStrCat(this->TargetDirectory, "/fortran.scan");
+  cmGeneratedFileStream fsStream(fsName);
+  fsStream << "# Fortran dependency scan results for this target.\n";
+  for (std::string const& setting : this->GetScanCacheSettings()) {
+    fsStream << setting << '\n';
+  }
+  for (auto const& i : this->Internal->ScanResults) {
+    cmDependsFortranScanEntry const& entry = i.second;
+    fsStream << "object " << i.first << '\n';
+    for (auto const& src : entry.Sources) {
+      fsStream << "source " << src.second << ' ' << src.first << '\n';
+    }
+    for (auto const& inc : entry.Includes) {
+      fsStream << "include " << inc.second << ' ' << inc.first << '\n';
+    }
+    for (cmFortranIncludeLookup const& lookup : entry.Lookups) {
+      if (lookup.LineDirective) {
+        fsStream << "lookup-line " << lookup.Name << '\n';
+      } else {
+        fsStream << "lookup-dir " << lookup.Directory << '\n';
+        fsStream << "lookup-name " << lookup.Name << '\n';
+      }
+      if (!lookup.Found.empty()) {
+        fsStream << "lookup-found " << lookup.Found << '\n';
+      }
+    }
+    for (std::string const& mod : entry.Info.Provides) {
+      fsStream << "provides " << mod << '\n';
+    }
+    for (std::string const& mod : entry.Info.Requires) {
+      fsStream << "requires " << mod << '\n';
+    }
+  }
+}
+
 bool cmDependsFortran::Finalize(std::ostream& makeDepends,
                                 std::ostream& internalDepends)
 {
@@ -183,6 +427,9 @@ bool cmDependsFortran::Finalize(std::ostream& makeDepends,
     fiStream << ' ' << i << '\n';
   }
 
+  // Store the scan results for reuse by the next run.
+  this->WriteScanCache();
+
   // Create a script to clean the modules.
   if (!provides.empty()) {
     std::string fcName =
@@ -544,24 +791,26 @@ static bool cmFortranStreamContainsSequence(std::istream& ifs, const char* seq,
 // Helper function to compare the remaining content in two streams.
 static bool cmFortranStreamsDiffer(std::istream& ifs1, std::istream& ifs2)
 {
-  // Compare the remaining content.
+  // Compare the remaining content a block at a time.
+  char buf1[4096];
+  char buf2[4096];
   for (;;) {
-    int ifs1_c = ifs1.get();
-    int ifs2_c = ifs2.get();
-    if (!ifs1 && !ifs2) {
+    ifs1.read(buf1, sizeof(buf1));
+    ifs2.read(buf2, sizeof(buf2));
+    std::streamsize const n1 = ifs1.gcount();
+    std::streamsize const n2 = ifs2.gcount();
+    if (n1 != n2 || memcmp(buf1, buf2, static_cast<size_t>(n1)) != 0) {
+      // We have reached the end of one stream before the other or
+      // found differing content.  The streams are different.
+      return true;
+    }
+
+    if (n1 < static_cast<std::streamsize>(sizeof(buf1))) {
       // We have reached the end of both streams simultaneously.
       // The streams are identical.
       return false;
     }
-
-    if (!ifs1 || !ifs2 || ifs1_c != ifs2_c) {
-      // We have reached the end of one stream before the other or
-      // found differing content.  The streams are different.
-      break;
-    }
   }
-
-  return true;
 }
 
 bool cmDependsFortran::ModulesDiffer(const std::string& modFile,
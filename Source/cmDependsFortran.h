@@ -14,6 +14,7 @@
 
 class cmDependsFortranInternals;
 class cmFortranSourceInfo;
+struct cmDependsFortranScanEntry;
 class cmLocalUnixMakefileGenerator3;
 
 /** \class cmDependsFortran
@@ -66,6 +67,13 @@ protected:
                          const std::string& file, std::ostream& makeDepends,
                          std::ostream& internalDepends) override;
 
+  // Persist scan results across runs in "fortran.scan".
+  std::vector<std::string> GetScanCacheSettings() const;
+  void LoadScanCache();
+  bool ScanEntryUpToDate(std::set<std::string> const& sources,
+                         cmDependsFortranScanEntry const& entry) const;
+  void WriteScanCache();
+
   // Actually write the dependencies to the streams.
   bool WriteDependenciesReal(std::string const& obj,
                              cmFortranSourceInfo const& info,
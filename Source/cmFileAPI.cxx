@@ -147,21 +147,12 @@ std::string cmFileAPI::WriteJsonFile(
   Json::Value const& value, std::string const& prefix,
   std::string (*computeSuffix)(std::string const&))
 {
-  std::string fileName;
-
-  // Write the json file with a temporary name.
-  std::string const& tmpFile = this->APIv1 + "/tmp.json";
-  cmsys::ofstream ftmp(tmpFile.c_str());
-  this->JsonWriter->write(value, &ftmp);
-  ftmp << "\n";
-  ftmp.close();
-  if (!ftmp) {
-    cmSystemTools::RemoveFile(tmpFile);
-    return fileName;
-  }
-
-  // Compute the final name for the file.
-  fileName = prefix + "-" + computeSuffix(tmpFile) + ".json";
+  // Serialize the json value and compute the final name for the file.
+  std::ostringstream content;
+  this->JsonWriter->write(value, &content);
+  content << "\n";
+  std::string const json = content.str();
+  std::string fileName = prefix + "-" + computeSuffix(json) + ".json";
 
   // Create the destination.
   std::string file = this->APIv1 + "/reply";
@@ -170,10 +161,20 @@ std::string cmFileAPI::WriteJsonFile(
   file += fileName;
 
   // If the final name already exists then assume it has proper content.
-  // Otherwise, atomically place the reply file at its final name
-  if (cmSystemTools::FileExists(file, true) ||
-      !cmSystemTools::RenameFile(tmpFile, file)) {
-    cmSystemTools::RemoveFile(tmpFile);
+  // Otherwise, write the file with a temporary name and atomically
+  // place the reply file at its final name.
+  if (!cmSystemTools::FileExists(file, true)) {
+    std::string const& tmpFile = this->APIv1 + "/tmp.json";
+    cmsys::ofstream ftmp(tmpFile.c_str());
+    ftmp << json;
+    ftmp.close();
+    if (!ftmp) {
+      cmSystemTools::RemoveFile(tmpFile);
+      return std::string();
+    }
+    if (!cmSystemTools::RenameFile(tmpFile, file)) {
+      cmSystemTools::RemoveFile(tmpFile);
+    }
   }
 
   // Record this among files we have just written.
@@ -194,10 +195,10 @@ Json::Value cmFileAPI::MaybeJsonFile(Json::Value in, std::string const& prefix)
   return out;
 }
 
-std::string cmFileAPI::ComputeSuffixHash(std::string const& file)
+std::string cmFileAPI::ComputeSuffixHash(std::string const& content)
 {
   cmCryptoHash hasher(cmCryptoHash::AlgoSHA3_256);
-  std::string hash = hasher.HashFile(file);
+  std::string hash = hasher.HashString(content);
   hash.resize(20, '0');
   return hash;
 }
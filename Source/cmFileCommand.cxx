@@ -490,20 +490,31 @@ bool HandleStringsCommand(std::vector<std::string> const& args,
     bytes_rem = 3;
   }
 
+  // Track the input position ourselves since asking the stream for
+  // it before every character costs a system call.
+  std::streamoff input_pos = limit_input < 0 ? 0 : std::streamoff(fin.tellg());
+  auto fin_get = [&fin, &input_pos]() -> int {
+    ++input_pos;
+    return fin.get();
+  };
+  auto fin_putback = [&fin, &input_pos](char ch) {
+    --input_pos;
+    fin.putback(ch);
+  };
+
   // Parse strings out of the file.
   int output_size = 0;
   std::vector<std::string> strings;
   std::string s;
   while ((!limit_count || strings.size() < limit_count) &&
-         (limit_input < 0 || static_cast<int>(fin.tellg()) < limit_input) &&
-         fin) {
+         (limit_input < 0 || input_pos < limit_input) && fin) {
     std::string current_str;
 
-    int c = fin.get();
+    int c = fin_get();
     for (unsigned int i = 0; i < bytes_rem; ++i) {
-      int c1 = fin.get();
+      int c1 = fin_get();
       if (!fin) {
-        fin.putback(static_cast<char>(c1));
+        fin_putback(static_cast<char>(c1));
         break;
       }
       c = (c << 8) | c1;
@@ -545,9 +556,9 @@ bool HandleStringsCommand(std::vector<std::string> const& args,
       // get subsequent octets and check that they are valid
       for (unsigned int j = 0; j < num_utf8_bytes; j++) {
         if (j != 0) {
-          c = fin.get();
+          c = fin_get();
           if (!fin || (c & 0xC0) != 0x80) {
-            fin.putback(static_cast<char>(c));
+            fin_putback(static_cast<char>(c));
             break;
           }
         }
@@ -558,7 +569,7 @@ bool HandleStringsCommand(std::vector<std::string> const& args,
       // back subsequent characters
       if ((current_str.length() != num_utf8_bytes)) {
         for (unsigned int j = 0; j < current_str.size() - 1; j++) {
-          fin.putback(current_str[current_str.size() - 1 - j]);
+          fin_putback(current_str[current_str.size() - 1 - j]);
         }
         current_str.clear();
       }
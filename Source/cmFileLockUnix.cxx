@@ -48,6 +48,9 @@ cmFileLockResult cmFileLock::LockWithoutTimeout()
 
 cmFileLockResult cmFileLock::LockWithTimeout(unsigned long seconds)
 {
+  // Retry at a short interval so that the lock is taken soon after it
+  // is released, while still giving up after the requested time.
+  unsigned int ticks = 0;
   while (true) {
     if (this->LockFile(F_SETLK, F_WRLCK) == -1) {
       if (errno != EACCES && errno != EAGAIN) {
@@ -59,8 +62,11 @@ cmFileLockResult cmFileLock::LockWithTimeout(unsigned long seconds)
     if (seconds == 0) {
       return cmFileLockResult::MakeTimeout();
     }
-    --seconds;
-    cmSystemTools::Delay(1000);
+    cmSystemTools::Delay(100);
+    if (++ticks == 10) {
+      ticks = 0;
+      --seconds;
+    }
   }
 }
 
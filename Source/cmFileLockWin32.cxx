@@ -61,6 +61,9 @@ cmFileLockResult cmFileLock::LockWithoutTimeout()
 cmFileLockResult cmFileLock::LockWithTimeout(unsigned long seconds)
 {
   const DWORD flags = LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY;
+  // Retry at a short interval so that the lock is taken soon after it
+  // is released, while still giving up after the requested time.
+  unsigned int ticks = 0;
   while (true) {
     const BOOL result = this->LockFile(flags);
     if (result) {
@@ -73,8 +76,11 @@ cmFileLockResult cmFileLock::LockWithTimeout(unsigned long seconds)
     if (seconds == 0) {
       return cmFileLockResult::MakeTimeout();
     }
-    --seconds;
-    cmSystemTools::Delay(1000);
+    cmSystemTools::Delay(100);
+    if (++ticks == 10) {
+      ticks = 0;
+      --seconds;
+    }
   }
 }
 
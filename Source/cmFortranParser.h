@@ -103,6 +103,20 @@ public:
   std::set<std::string> Includes;
 };
 
+// A file name looked up while parsing, and the file it resolved to.
+class cmFortranIncludeLookup
+{
+public:
+  // The directory of the including file, and the name it included.
+  // A #line directive names its file directly and has no directory.
+  std::string Directory;
+  std::string Name;
+  bool LineDirective = false;
+
+  // The file that was found, or empty if none was.
+  std::string Found;
+};
+
 // Parser methods not included in generated interface.
 
 // Get the current buffer processed by the lexer.
@@ -145,6 +159,9 @@ struct cmFortranParser_s
 
   bool FindIncludeFile(const char* dir, const char* includeName,
                        std::string& fileName);
+  static bool FindIncludeFile(std::vector<std::string> const& includePath,
+                              const char* dir, const char* includeName,
+                              std::string& fileName);
 
   std::string ModName(std::string const& mod_name) const;
   std::string SModName(std::string const& mod_name,
@@ -171,6 +188,9 @@ struct cmFortranParser_s
   // Flag for whether lexer is reading from inside an interface.
   bool InInterface;
 
+  // Every include file lookup made, in order.
+  std::vector<cmFortranIncludeLookup> IncludeLookups;
+
   int OldStartcond;
   std::set<std::string> PPDefinitions;
   size_t InPPFalseBranch;
@@ -15,6 +15,14 @@
 bool cmFortranParser_s::FindIncludeFile(const char* dir,
                                         const char* includeName,
                                         std::string& fileName)
+{
+  return cmFortranParser_s::FindIncludeFile(this->IncludePath, dir,
+                                            includeName, fileName);
+}
+
+bool cmFortranParser_s::FindIncludeFile(
+  std::vector<std::string> const& includePath, const char* dir,
+  const char* includeName, std::string& fileName)
 {
   // If the file is a full path, include it directly.
   if (cmSystemTools::FileIsFullPath(includeName)) {
@@ -30,7 +38,7 @@ bool cmFortranParser_s::FindIncludeFile(const char* dir,
   }
 
   // Search the include path for the file.
-  for (std::string const& i : this->IncludePath) {
+  for (std::string const& i : includePath) {
     fullName = cmStrCat(i, '/', includeName);
     if (cmSystemTools::FileExists(fullName, true)) {
       fileName = fullName;
@@ -214,10 +222,16 @@ void cmFortranParser_RuleLineDirective(cmFortranParser* parser,
   cmSystemTools::ReplaceString(included, "\\\\", "\\");
   cmSystemTools::ConvertToUnixSlashes(included);
 
+  cmFortranIncludeLookup lookup;
+  lookup.Name = included;
+  lookup.LineDirective = true;
+
   // Save the named file as included in the source.
   if (cmSystemTools::FileExists(included, true)) {
     parser->Info.Includes.insert(included);
+    lookup.Found = included;
   }
+  parser->IncludeLookups.push_back(std::move(lookup));
 }
 
 void cmFortranParser_RuleInclude(cmFortranParser* parser, const char* name)
@@ -238,7 +252,19 @@ void cmFortranParser_RuleInclude(cmFortranParser* parser, const char* name)
   // problem because either the source will not compile or the user
   // does not care about depending on this included source.
   std::string fullName;
-  if (parser->FindIncludeFile(dir.c_str(), name, fullName)) {
+  bool const found = parser->FindIncludeFile(dir.c_str(), name, fullName);
+
+  // Remember the lookup so a later scan can tell whether it would now
+  // find a different file.
+  cmFortranIncludeLookup lookup;
+  lookup.Directory = dir;
+  lookup.Name = name;
+  if (found) {
+    lookup.Found = fullName;
+  }
+  parser->IncludeLookups.push_back(std::move(lookup));
+
+  if (found) {
     // Found the included file.  Save it in the set of included files.
     parser->Info.Includes.insert(fullName);
 
@@ -12,8 +12,35 @@
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
 
-cm::optional<cmGccDepfileContent> cmReadGccDepfile(const char* filePath,
-                                                   const std::string& prefix)
+namespace {
+void NormalizePath(std::string& path, const std::string& prefix,
+                   cmGccDepfilePathCache* pathCache)
+{
+  if (!prefix.empty() && !cmSystemTools::FileIsFullPath(path)) {
+    path = cmStrCat(prefix, '/', path);
+  }
+  if (pathCache) {
+    auto const i = pathCache->find(path);
+    if (i != pathCache->end()) {
+      path = i->second;
+      return;
+    }
+  }
+  std::string normalized = path;
+  if (cmSystemTools::FileIsFullPath(normalized)) {
+    normalized = cmSystemTools::CollapseFullPath(normalized);
+  }
+  cmSystemTools::ConvertToLongPath(normalized);
+  if (pathCache) {
+    pathCache->emplace(std::move(path), normalized);
+  }
+  path = std::move(normalized);
+}
+}
+
+cm::optional<cmGccDepfileContent> cmReadGccDepfile(
+  const char* filePath, const std::string& prefix,
+  cmGccDepfilePathCache* pathCache)
 {
   cmGccDepfileLexerHelper helper;
   if (!helper.readFile(filePath)) {
@@ -23,22 +50,10 @@ cm::optional<cmGccDepfileContent> cmReadGccDepfile(const char* filePath,
 
   for (auto& dep : *deps) {
     for (auto& rule : dep.rules) {
-      if (!prefix.empty() && !cmSystemTools::FileIsFullPath(rule)) {
-        rule = cmStrCat(prefix, '/', rule);
-      }
-      if (cmSystemTools::FileIsFullPath(rule)) {
-        rule = cmSystemTools::CollapseFullPath(rule);
-      }
-      cmSystemTools::ConvertToLongPath(rule);
+      NormalizePath(rule, prefix, pathCache);
     }
     for (auto& path : dep.paths) {
-      if (!prefix.empty() && !cmSystemTools::FileIsFullPath(path)) {
-        path = cmStrCat(prefix, '/', path);
-      }
-      if (cmSystemTools::FileIsFullPath(path)) {
-        path = cmSystemTools::CollapseFullPath(path);
-      }
-      cmSystemTools::ConvertToLongPath(path);
+      NormalizePath(path, prefix, pathCache);
     }
   }
 
@@ -3,13 +3,22 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
 #include <cm/optional>
 
 #include "cmGccDepfileReaderTypes.h"
 
+/*
+ * Map from paths read from dependencies files, after prefixing, to their
+ * normalized form.  It may be shared by calls reading many files so that
+ * paths common to several of them are normalized only once.
+ */
+using cmGccDepfilePathCache = std::unordered_map<std::string, std::string>;
+
 /*
  * Read dependencies file and append prefix to all relative paths
  */
 cm::optional<cmGccDepfileContent> cmReadGccDepfile(
-  const char* filePath, const std::string& prefix = {});
+  const char* filePath, const std::string& prefix = {},
+  cmGccDepfilePathCache* pathCache = nullptr);
@@ -106,6 +106,13 @@ cmCompiledGeneratorExpression::cmCompiledGeneratorExpression(
   , HadHeadSensitiveCondition(false)
   , HadLinkLanguageSensitiveCondition(false)
 {
+  // Most values contain no generator expression at all.  Skip the
+  // lexer for them since it cannot see one either.
+  if (cmGeneratorExpression::Find(this->Input) == std::string::npos) {
+    this->NeedsEvaluation = false;
+    return;
+  }
+
   cmGeneratorExpressionLexer l;
   std::vector<cmGeneratorExpressionToken> tokens = l.Tokenize(this->Input);
   this->NeedsEvaluation = l.GetSawGeneratorExpression();
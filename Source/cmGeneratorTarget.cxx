@@ -12,6 +12,8 @@
 #include <iterator>
 #include <queue>
 #include <sstream>
+#include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -30,7 +32,6 @@
 #include "cmGeneratorExpression.h"
 #include "cmGeneratorExpressionContext.h"
 #include "cmGeneratorExpressionDAGChecker.h"
-#include "cmGeneratorExpressionNode.h"
 #include "cmGlobalGenerator.h"
 #include "cmLocalGenerator.h"
 #include "cmMakefile.h"
@@ -1344,8 +1345,8 @@ std::string cmGeneratorTarget::EvaluateInterfaceProperty(
     context->HeadTarget ? context->HeadTarget : this;
 
   if (cmProp p = this->GetProperty(prop)) {
-    result = cmGeneratorExpressionNode::EvaluateDependentExpression(
-      *p, context->LG, context, headTarget, &dagChecker, this);
+    result = this->EvaluateInterfacePropertyValue(prop, *p, context,
+                                                  headTarget, &dagChecker);
   }
 
   if (cmLinkInterfaceLibraries const* iface = this->GetLinkInterfaceLibraries(
@@ -1390,6 +1391,102 @@ std::string cmGeneratorTarget::EvaluateInterfaceProperty(
   return result;
 }
 
+std::string cmGeneratorTarget::EvaluateInterfacePropertyValue(
+  std::string const& prop, std::string const& value,
+  cmGeneratorExpressionContext* context, cmGeneratorTarget const* headTarget,
+  cmGeneratorExpressionDAGChecker* dagChecker) const
+{
+  // Record every part of the evaluation context that a generator
+  // expression not referring to any target may observe.
+  unsigned flags = 0;
+  unsigned bit = 1;
+  for (bool f :
+       { context->Quiet, context->EvaluateForBuildsystem,
+         dagChecker->GetTransitivePropertiesOnly(),
+         dagChecker->EvaluatingGenexExpression(),
+         dagChecker->EvaluatingPICExpression(),
+         dagChecker->EvaluatingCompileExpression(),
+         dagChecker->EvaluatingLinkExpression(),
+         dagChecker->EvaluatingLinkOptionsExpression(),
+         dagChecker->EvaluatingLinkLibraries(), headTarget->IsDeviceLink() }) {
+    if (f) {
+      flags |= bit;
+    }
+    bit <<= 1;
+  }
+  InterfacePropertyValueKey key = std::make_tuple(
+    context->Config, context->Language, headTarget, context->LG, flags);
+
+  InterfacePropertyValues& values = this->InterfacePropertyValueCache[prop];
+  if (values.Input != value) {
+    values.Input = value;
+    values.Results.clear();
+    values.ResultIndex.clear();
+  }
+
+  auto it = values.ResultIndex.find(key);
+  if (it != values.ResultIndex.end()) {
+    InterfacePropertyResult const& cached = values.Results[it->second];
+    context->HadContextSensitiveCondition =
+      context->HadContextSensitiveCondition ||
+      cached.HadContextSensitiveCondition;
+    context->HadHeadSensitiveCondition =
+      context->HadHeadSensitiveCondition || cached.HadHeadSensitiveCondition;
+    context->HadLinkLanguageSensitiveCondition =
+      context->HadLinkLanguageSensitiveCondition ||
+      cached.HadLinkLanguageSensitiveCondition;
+    return cached.Value;
+  }
+
+  cmGeneratorExpression ge(context->Backtrace);
+  std::unique_ptr<cmCompiledGeneratorExpression> cge = ge.Parse(value);
+  cge->SetEvaluateForBuildsystem(context->EvaluateForBuildsystem);
+  cge->SetQuiet(context->Quiet);
+  std::string result = cge->Evaluate(context->LG, context->Config, headTarget,
+                                     dagChecker, this, context->Language);
+  if (cge->GetHadContextSensitiveCondition()) {
+    context->HadContextSensitiveCondition = true;
+  }
+  if (cge->GetHadHeadSensitiveCondition()) {
+    context->HadHeadSensitiveCondition = true;
+  }
+  if (cge->GetHadLinkLanguageSensitiveCondition()) {
+    context->HadLinkLanguageSensitiveCondition = true;
+  }
+
+  // An expression that looked at any target may depend on the state of
+  // the DAG checker, so only remember results that did not.
+  if (cge->GetAllTargetsSeen().empty() &&
+      cge->GetSeenTargetProperties().empty() && cge->GetTargets().empty() &&
+      !cmSystemTools::GetErrorOccuredFlag()) {
+    InterfacePropertyResult entry;
+    entry.HadContextSensitiveCondition =
+      cge->GetHadContextSensitiveCondition();
+    entry.HadHeadSensitiveCondition = cge->GetHadHeadSensitiveCondition();
+    entry.HadLinkLanguageSensitiveCondition =
+      cge->GetHadLinkLanguageSensitiveCondition();
+
+    // Most contexts evaluate to one of very few results, so share them.
+    auto same = std::find_if(
+      values.Results.begin(), values.Results.end(),
+      [&result, &entry](InterfacePropertyResult const& r) {
+        return r.Value == result &&
+          r.HadContextSensitiveCondition ==
+          entry.HadContextSensitiveCondition &&
+          r.HadHeadSensitiveCondition == entry.HadHeadSensitiveCondition &&
+          r.HadLinkLanguageSensitiveCondition ==
+          entry.HadLinkLanguageSensitiveCondition;
+      });
+    std::size_t const index = same - values.Results.begin();
+    if (same == values.Results.end()) {
+      entry.Value = result;
+      values.Results.push_back(std::move(entry));
+    }
+    values.ResultIndex.emplace(std::move(key), index);
+  }
+  return result;
+}
+
 namespace {
 
 enum class IncludeDirectoryFallBack
@@ -2625,15 +2722,14 @@ cmGeneratorTarget::LinkClosure const* cmGeneratorTarget::GetLinkClosure(
     return &empty;
   }
 
-  std::string key(cmSystemTools::UpperCase(config));
-  auto i = this->LinkClosureMap.find(key);
-  if (i == this->LinkClosureMap.end()) {
+  std::size_t const index = this->GlobalGenerator->GetConfigIndex(config);
+  LinkClosure const* closure = this->LinkClosureMap.Find(index);
+  if (!closure) {
     LinkClosure lc;
     this->ComputeLinkClosure(config, lc);
-    LinkClosureMapType::value_type entry(key, lc);
-    i = this->LinkClosureMap.insert(entry).first;
+    closure = &this->LinkClosureMap.Emplace(index, std::move(lc));
   }
-  return &i->second;
+  return closure;
 }
 
 class cmTargetSelectLinker
@@ -2842,18 +2938,14 @@ cmGeneratorTarget::CompileInfo const* cmGeneratorTarget::GetCompileInfo(
   }
 
   // Lookup/compute/cache the compile information for this configuration.
-  std::string config_upper;
-  if (!config.empty()) {
-    config_upper = cmSystemTools::UpperCase(config);
-  }
-  auto i = this->CompileInfoMap.find(config_upper);
-  if (i == this->CompileInfoMap.end()) {
+  std::size_t const index = this->GlobalGenerator->GetConfigIndex(config);
+  CompileInfo const* compileInfo = this->CompileInfoMap.Find(index);
+  if (!compileInfo) {
     CompileInfo info;
     this->ComputePDBOutputDir("COMPILE_PDB", config, info.CompilePdbDir);
-    CompileInfoMapType::value_type entry(config_upper, info);
-    i = this->CompileInfoMap.insert(entry).first;
+    compileInfo = &this->CompileInfoMap.Emplace(index, std::move(info));
   }
-  return &i->second;
+  return compileInfo;
 }
 
 cmGeneratorTarget::ModuleDefinitionInfo const*
@@ -2867,18 +2959,14 @@ cmGeneratorTarget::GetModuleDefinitionInfo(std::string const& config) const
   }
 
   // Lookup/compute/cache the compile information for this configuration.
-  std::string config_upper;
-  if (!config.empty()) {
-    config_upper = cmSystemTools::UpperCase(config);
-  }
-  auto i = this->ModuleDefinitionInfoMap.find(config_upper);
-  if (i == this->ModuleDefinitionInfoMap.end()) {
+  std::size_t const index = this->GlobalGenerator->GetConfigIndex(config);
+  ModuleDefinitionInfo const* mdi = this->ModuleDefinitionInfoMap.Find(index);
+  if (!mdi) {
     ModuleDefinitionInfo info;
     this->ComputeModuleDefinitionInfo(config, info);
-    ModuleDefinitionInfoMapType::value_type entry(config_upper, info);
-    i = this->ModuleDefinitionInfoMap.insert(entry).first;
+    mdi = &this->ModuleDefinitionInfoMap.Emplace(index, std::move(info));
   }
-  return &i->second;
+  return mdi;
 }
 
 void cmGeneratorTarget::ComputeModuleDefinitionInfo(
@@ -5478,6 +5566,23 @@ const char* getLinkInterfaceDependentProperty(cmGeneratorTarget const* tgt,
   return nullptr;
 }
 
+namespace {
+bool isDocumentedTargetProperty(std::string const& p)
+{
+  // The same names are checked for every depender of a target, so
+  // remember whether the documentation of each one exists.
+  static std::unordered_map<std::string, bool> documented;
+  auto it = documented.find(p);
+  if (it == documented.end()) {
+    std::string const pfile =
+      cmStrCat(cmSystemTools::GetCMakeRoot(), "/Help/prop_tgt/",
+               cmSystemTools::HelpFileName(p), ".rst");
+    it = documented.emplace(p, cmSystemTools::FileExists(pfile, true)).first;
+  }
+  return it->second;
+}
+}
+
 template <typename PropertyType>
 void checkPropertyConsistency(cmGeneratorTarget const* depender,
                               cmGeneratorTarget const* dependee,
@@ -5492,13 +5597,9 @@ void checkPropertyConsistency(cmGeneratorTarget const* depender,
   }
 
   std::vector<std::string> props = cmExpandedList(*prop);
-  std::string pdir =
-    cmStrCat(cmSystemTools::GetCMakeRoot(), "/Help/prop_tgt/");
 
   for (std::string const& p : props) {
-    std::string pname = cmSystemTools::HelpFileName(p);
-    std::string pfile = pdir + pname + ".rst";
-    if (cmSystemTools::FileExists(pfile, true)) {
+    if (isDocumentedTargetProperty(p)) {
       std::ostringstream e;
       e << "Target \"" << dependee->GetName() << "\" has property \"" << p
         << "\" listed in its " << propName
@@ -6074,9 +6175,10 @@ cmComputeLinkInformation* cmGeneratorTarget::GetLinkInformation(
   const std::string& config) const
 {
   // Lookup any existing information for this configuration.
-  std::string key(cmSystemTools::UpperCase(config));
-  auto i = this->LinkInformation.find(key);
-  if (i == this->LinkInformation.end()) {
+  std::size_t const index = this->GlobalGenerator->GetConfigIndex(config);
+  std::unique_ptr<cmComputeLinkInformation>* cli =
+    this->LinkInformation.Find(index);
+  if (!cli) {
     // Compute information for this configuration.
     auto info = cm::make_unique<cmComputeLinkInformation>(this, config);
     if (info && !info->Compute()) {
@@ -6084,13 +6186,13 @@ cmComputeLinkInformation* cmGeneratorTarget::GetLinkInformation(
     }
 
     // Store the information for this configuration.
-    i = this->LinkInformation.emplace(key, std::move(info)).first;
+    cli = &this->LinkInformation.Emplace(index, std::move(info));
 
-    if (i->second) {
-      this->CheckPropertyCompatibility(*i->second, config);
+    if (*cli) {
+      this->CheckPropertyCompatibility(**cli, config);
     }
   }
-  return i->second.get();
+  return cli->get();
 }
 
 void cmGeneratorTarget::GetTargetVersion(int& major, int& minor) const
@@ -6632,16 +6734,12 @@ cmGeneratorTarget::OutputInfo const* cmGeneratorTarget::GetOutputInfo(
   }
 
   // Lookup/compute/cache the output information for this configuration.
-  std::string config_upper;
-  if (!config.empty()) {
-    config_upper = cmSystemTools::UpperCase(config);
-  }
-  auto i = this->OutputInfoMap.find(config_upper);
-  if (i == this->OutputInfoMap.end()) {
+  std::size_t const index = this->GlobalGenerator->GetConfigIndex(config);
+  OutputInfo* outputInfo = this->OutputInfoMap.Find(index);
+  if (!outputInfo) {
     // Add empty info in map to detect potential recursion.
     OutputInfo info;
-    OutputInfoMapType::value_type entry(config_upper, info);
-    i = this->OutputInfoMap.insert(entry).first;
+    outputInfo = &this->OutputInfoMap.Emplace(index, info);
 
     // Compute output directories.
     this->ComputeOutputDir(config, cmStateEnums::RuntimeBinaryArtifact,
@@ -6653,8 +6751,8 @@ cmGeneratorTarget::OutputInfo const* cmGeneratorTarget::GetOutputInfo(
     }
 
     // Now update the previously-prepared map entry.
-    i->second = info;
-  } else if (i->second.empty()) {
+    *outputInfo = info;
+  } else if (outputInfo->empty()) {
     // An empty map entry indicates we have been called recursively
     // from the above block.
     this->LocalGenerator->GetCMakeInstance()->IssueMessage(
@@ -6663,7 +6761,7 @@ cmGeneratorTarget::OutputInfo const* cmGeneratorTarget::GetOutputInfo(
       this->GetBacktrace());
     return nullptr;
   }
-  return &i->second;
+  return outputInfo;
 }
 
 bool cmGeneratorTarget::ComputeOutputDir(const std::string& config,
@@ -7110,32 +7208,31 @@ cmGeneratorTarget::ImportInfo const* cmGeneratorTarget::GetImportInfo(
 
   // Lookup/compute/cache the import information for this
   // configuration.
-  std::string config_upper;
-  if (!config.empty()) {
-    config_upper = cmSystemTools::UpperCase(config);
-  } else {
-    config_upper = "NOCONFIG";
-  }
-
-  auto i = this->ImportInfoMap.find(config_upper);
-  if (i == this->ImportInfoMap.end()) {
+  std::size_t const index = this->GlobalGenerator->GetConfigIndex(config);
+  ImportInfo const* importInfo = this->ImportInfoMap.Find(index);
+  if (!importInfo) {
+    std::string config_upper;
+    if (!config.empty()) {
+      config_upper = cmSystemTools::UpperCase(config);
+    } else {
+      config_upper = "NOCONFIG";
+    }
     ImportInfo info;
     this->ComputeImportInfo(config_upper, info);
-    ImportInfoMapType::value_type entry(config_upper, info);
-    i = this->ImportInfoMap.insert(entry).first;
+    importInfo = &this->ImportInfoMap.Emplace(index, std::move(info));
   }
 
   if (this->GetType() == cmStateEnums::INTERFACE_LIBRARY) {
-    return &i->second;
+    return importInfo;
   }
   // If the location is empty then the target is not available for
   // this configuration.
-  if (i->second.Location.empty() && i->second.ImportLibrary.empty()) {
+  if (importInfo->Location.empty() && importInfo->ImportLibrary.empty()) {
     return nullptr;
   }
 
   // Return the import information.
-  return &i->second;
+  return importInfo;
 }
 
 void cmGeneratorTarget::ComputeImportInfo(std::string const& desired_config,
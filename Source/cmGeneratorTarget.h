@@ -9,11 +9,13 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <cm/memory>
 #include <cm/optional>
 
 #include "cmLinkItem.h"
@@ -608,6 +610,30 @@ public:
   /** Whether this library has soname enabled and platform supports it.  */
   bool HasSOName(const std::string& config) const;
 
+  // Cache entries for each configuration, indexed by
+  // cmGlobalGenerator::GetConfigIndex.  Entries never move once created.
+  template <typename T>
+  class PerConfigCache
+  {
+  public:
+    T* Find(std::size_t index) const
+    {
+      return index < this->Entries.size() ? this->Entries[index].get()
+                                          : nullptr;
+    }
+    T& Emplace(std::size_t index, T value)
+    {
+      if (index >= this->Entries.size()) {
+        this->Entries.resize(index + 1);
+      }
+      this->Entries[index] = cm::make_unique<T>(std::move(value));
+      return *this->Entries[index];
+    }
+
+  private:
+    std::vector<std::unique_ptr<T>> Entries;
+  };
+
   struct CompileInfo
   {
     std::string CompilePdbDir;
@@ -615,8 +641,7 @@ public:
 
   CompileInfo const* GetCompileInfo(const std::string& config) const;
 
-  using CompileInfoMapType = std::map<std::string, CompileInfo>;
-  mutable CompileInfoMapType CompileInfoMap;
+  mutable PerConfigCache<CompileInfo> CompileInfoMap;
 
   bool IsNullImpliedByLinkLibraries(const std::string& p) const;
 
@@ -892,8 +917,7 @@ private:
                            std::string& outSuffix) const;
 
   mutable std::string LinkerLanguage;
-  using LinkClosureMapType = std::map<std::string, LinkClosure>;
-  mutable LinkClosureMapType LinkClosureMap;
+  mutable PerConfigCache<LinkClosure> LinkClosureMap;
   bool DeviceLink = false;
 
   // Returns ARCHIVE, LIBRARY, or RUNTIME based on platform and type.
@@ -920,9 +944,8 @@ private:
   };
   mutable std::map<std::string, CompatibleInterfaces> CompatibleInterfacesMap;
 
-  using cmTargetLinkInformationMap =
-    std::map<std::string, std::unique_ptr<cmComputeLinkInformation>>;
-  mutable cmTargetLinkInformationMap LinkInformation;
+  mutable PerConfigCache<std::unique_ptr<cmComputeLinkInformation>>
+    LinkInformation;
 
   void CheckPropertyCompatibility(cmComputeLinkInformation& info,
                                   const std::string& config) const;
@@ -976,8 +999,7 @@ private:
     std::string SharedDeps;
   };
 
-  using ImportInfoMapType = std::map<std::string, ImportInfo>;
-  mutable ImportInfoMapType ImportInfoMap;
+  mutable PerConfigCache<ImportInfo> ImportInfoMap;
   void ComputeImportInfo(std::string const& desired_config,
                          ImportInfo& info) const;
   ImportInfo const* GetImportInfo(const std::string& config) const;
@@ -1004,6 +1026,37 @@ private:
                                   cmGeneratorExpressionContext* context,
                                   bool usage_requirements_only) const;
 
+  // Cache the evaluation of this target's own value of a transitive
+  // interface property for evaluations that do not depend on anything
+  // beyond the evaluation context.  The property value is kept once per
+  // property and each distinct result once, so an evaluation context
+  // costs only its key.  The contexts are bounded by the configurations,
+  // languages and head targets that consume this target, and results
+  // that look at any target are not cached at all.
+  using InterfacePropertyValueKey =
+    std::tuple<std::string, std::string, cmGeneratorTarget const*,
+               cmLocalGenerator const*, unsigned>;
+  struct InterfacePropertyResult
+  {
+    std::string Value;
+    bool HadContextSensitiveCondition = false;
+    bool HadHeadSensitiveCondition = false;
+    bool HadLinkLanguageSensitiveCondition = false;
+  };
+  struct InterfacePropertyValues
+  {
+    std::string Input;
+    std::vector<InterfacePropertyResult> Results;
+    std::map<InterfacePropertyValueKey, std::size_t> ResultIndex;
+  };
+  mutable std::unordered_map<std::string, InterfacePropertyValues>
+    InterfacePropertyValueCache;
+  std::string EvaluateInterfacePropertyValue(
+    std::string const& prop, std::string const& value,
+    cmGeneratorExpressionContext* context,
+    cmGeneratorTarget const* headTarget,
+    cmGeneratorExpressionDAGChecker* dagChecker) const;
+
   using TargetPropertyEntryVector =
     std::vector<std::unique_ptr<TargetPropertyEntry>>;
 
@@ -1065,12 +1118,9 @@ private:
                         cmStateEnums::ArtifactType artifact,
                         std::string& out) const;
 
-  using OutputInfoMapType = std::map<std::string, OutputInfo>;
-  mutable OutputInfoMapType OutputInfoMap;
+  mutable PerConfigCache<OutputInfo> OutputInfoMap;
 
-  using ModuleDefinitionInfoMapType =
-    std::map<std::string, ModuleDefinitionInfo>;
-  mutable ModuleDefinitionInfoMapType ModuleDefinitionInfoMap;
+  mutable PerConfigCache<ModuleDefinitionInfo> ModuleDefinitionInfoMap;
   void ComputeModuleDefinitionInfo(std::string const& config,
                                    ModuleDefinitionInfo& info) const;
 
@@ -1508,7 +1508,10 @@ void cmGlobalGenerator::Generate()
 
   this->CMakeInstance->UpdateProgress("Generating", 0.1f);
 
-  // Generate project files
+  // Generate project files.  This must be done serially: the target
+  // generators share output streams owned by the global generator, and
+  // generation fills the mutable caches of cmGeneratorTarget and
+  // cmLocalGenerator on demand without any synchronization.
   for (unsigned int i = 0; i < this->LocalGenerators.size(); ++i) {
     this->SetCurrentMakefile(this->LocalGenerators[i]->GetMakefile());
     this->LocalGenerators[i]->Generate();
@@ -2379,6 +2382,25 @@ std::string cmGlobalGenerator::IndexGeneratorTargetUniquely(
   return id;
 }
 
+std::size_t cmGlobalGenerator::GetConfigIndex(std::string const& config) const
+{
+  auto i = this->ConfigIndexes.find(config);
+  if (i != this->ConfigIndexes.end()) {
+    return i->second;
+  }
+  std::string const configUpper = cmSystemTools::UpperCase(config);
+  auto u = this->ConfigIndexes.find(configUpper);
+  std::size_t index;
+  if (u != this->ConfigIndexes.end()) {
+    index = u->second;
+  } else {
+    index = this->ConfigIndexCount++;
+    this->ConfigIndexes.emplace(configUpper, index);
+  }
+  this->ConfigIndexes.emplace(config, index);
+  return index;
+}
+
 void cmGlobalGenerator::IndexMakefile(cmMakefile* mf)
 {
   // We index by both source and binary directory.  add_subdirectory
@@ -2988,8 +3010,11 @@ std::set<std::string> const& cmGlobalGenerator::GetDirectoryContent(
 {
   DirectoryContent& dc = this->DirectoryContentMap[dir];
   if (needDisk) {
-    long mt = cmSystemTools::ModifiedTime(dir);
-    if (mt != dc.LastDiskTime) {
+    // Compare with full file time resolution so that files created
+    // within the same second as a previous load are seen.
+    cmFileTime mt;
+    mt.Load(dir);
+    if (!dc.Loaded || mt.Differ(dc.LastDiskTime)) {
       // Reset to non-loaded directory content.
       dc.All = dc.Generated;
 
@@ -3005,6 +3030,7 @@ std::set<std::string> const& cmGlobalGenerator::GetDirectoryContent(
         }
       }
       dc.LastDiskTime = mt;
+      dc.Loaded = true;
     }
   }
   return dc.All;
@@ -3237,6 +3263,11 @@ void cmGlobalGenerator::WriteSummary(cmGeneratorTarget* target)
 // static
 std::string cmGlobalGenerator::EscapeJSON(const std::string& s)
 {
+  // Most paths and command lines need no escaping at all.
+  if (s.find_first_of("\"\\\n\t") == std::string::npos) {
+    return s;
+  }
+
   std::string result;
   result.reserve(s.size());
   for (char i : s) {
@@ -23,6 +23,7 @@
 #include "cmCustomCommandLines.h"
 #include "cmDuration.h"
 #include "cmExportSet.h"
+#include "cmFileTime.h"
 #include "cmStateSnapshot.h"
 #include "cmStringAlgorithms.h"
 #include "cmSystemTools.h"
@@ -388,6 +389,10 @@ public:
   // even if other targets have the same name.
   std::string IndexGeneratorTargetUniquely(cmGeneratorTarget const* gt);
 
+  // Get a small dense index identifying a configuration name
+  // case-insensitively, for use by per-configuration caches.
+  std::size_t GetConfigIndex(std::string const& config) const;
+
   static bool IsReservedTarget(std::string const& name);
 
   virtual const char* GetAllTargetName() const { return "ALL_BUILD"; }
@@ -614,7 +619,7 @@ protected:
   std::map<std::string, cmExportBuildFileGenerator*> BuildExportSets;
   std::map<std::string, cmExportBuildFileGenerator*> BuildExportExportSets;
 
-  std::map<std::string, std::string> AliasTargets;
+  std::unordered_map<std::string, std::string> AliasTargets;
 
   cmTarget* FindTargetImpl(std::string const& name) const;
 
@@ -659,6 +664,10 @@ private:
   void ComputeTargetOrder(cmGeneratorTarget const* gt, size_t& index);
   std::map<cmGeneratorTarget const*, size_t> TargetOrderIndex;
 
+  // Map configuration names, as given and upper-cased, to their index.
+  mutable std::unordered_map<std::string, std::size_t> ConfigIndexes;
+  mutable std::size_t ConfigIndexCount = 0;
+
   cmMakefile* TryCompileOuterMakefile;
   // If you add a new map here, make sure it is copied
   // in EnableLanguagesFromGenerator
@@ -732,7 +741,8 @@ private:
   // Cache directory content and target files to be built.
   struct DirectoryContent
   {
-    long LastDiskTime = -1;
+    cmFileTime LastDiskTime;
+    bool Loaded = false;
     std::set<std::string> All;
     std::set<std::string> Generated;
   };
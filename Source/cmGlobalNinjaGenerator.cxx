@@ -185,6 +185,10 @@ std::string cmGlobalNinjaGenerator::EncodePath(const std::string& path)
   else
     std::replace(result.begin(), result.end(), '/', '\\');
 #endif
+  // Most paths contain nothing that needs escaping.
+  if (result.find_first_of("$\n :") == std::string::npos) {
+    return result;
+  }
   result = this->EncodeLiteral(result);
   cmSystemTools::ReplaceString(result, " ", "$ ");
   cmSystemTools::ReplaceString(result, ":", "$:");
@@ -217,7 +221,7 @@ void cmGlobalNinjaGenerator::WriteBuild(std::ostream& os,
   {
     // Write explicit outputs
     for (std::string const& output : build.Outputs) {
-      buildStr = cmStrCat(buildStr, ' ', this->EncodePath(output));
+      buildStr += cmStrCat(' ', this->EncodePath(output));
       if (this->ComputingUnknownDependencies) {
         this->CombinedBuildOutputs.insert(output);
       }
@@ -226,9 +230,9 @@ void cmGlobalNinjaGenerator::WriteBuild(std::ostream& os,
     if (!build.ImplicitOuts.empty()) {
       // Assume Ninja is new enough to support implicit outputs.
       // Callers should not populate this field otherwise.
-      buildStr = cmStrCat(buildStr, " |");
+      buildStr += " |";
       for (std::string const& implicitOut : build.ImplicitOuts) {
-        buildStr = cmStrCat(buildStr, ' ', this->EncodePath(implicitOut));
+        buildStr += cmStrCat(' ', this->EncodePath(implicitOut));
         if (this->ComputingUnknownDependencies) {
           this->CombinedBuildOutputs.insert(implicitOut);
         }
@@ -242,16 +246,16 @@ void cmGlobalNinjaGenerator::WriteBuild(std::ostream& os,
     if (!build.WorkDirOuts.empty()) {
       if (this->SupportsImplicitOuts() && build.ImplicitOuts.empty()) {
         // Make them implicit outputs if supported by this version of Ninja.
-        buildStr = cmStrCat(buildStr, " |");
+        buildStr += " |";
       }
       for (std::string const& workdirOut : build.WorkDirOuts) {
-        buildStr = cmStrCat(buildStr, " ${cmake_ninja_workdir}",
-                            this->EncodePath(workdirOut));
+        buildStr +=
+          cmStrCat(" ${cmake_ninja_workdir}", this->EncodePath(workdirOut));
       }
     }
 
     // Write the rule.
-    buildStr = cmStrCat(buildStr, ": ", build.Rule);
+    buildStr += cmStrCat(": ", build.Rule);
   }
 
   std::string arguments;
@@ -1189,9 +1193,12 @@ void cmGlobalNinjaGenerator::AddCXXCompileCommand(
   const std::string& commandLine, const std::string& sourceFile)
 {
   // Compute Ninja's build file path.
-  std::string buildFileDir =
+  std::string const& buildFileDir =
     this->GetCMakeInstance()->GetHomeOutputDirectory();
   if (!this->CompileCommandsStream) {
+    this->CompileCommandsDirectory =
+      cmGlobalGenerator::EscapeJSON(buildFileDir);
+
     std::string buildFilePath =
       cmStrCat(buildFileDir, "/compile_commands.json");
     if (this->ComputingUnknownDependencies) {
@@ -1216,7 +1223,7 @@ void cmGlobalNinjaGenerator::AddCXXCompileCommand(
   /* clang-format off */
   *this->CompileCommandsStream << "{\n"
      << R"(  "directory": ")"
-     << cmGlobalGenerator::EscapeJSON(buildFileDir) << "\",\n"
+     << this->CompileCommandsDirectory << "\",\n"
      << R"(  "command": ")"
      << cmGlobalGenerator::EscapeJSON(commandLine) << "\",\n"
      << R"(  "file": ")"
@@ -2509,6 +2516,7 @@ bool cmGlobalNinjaGenerator::WriteDyndepFile(
   }
 
   std::vector<cmScanDepInfo> objects;
+  objects.reserve(arg_ddis.size());
   for (std::string const& arg_ddi : arg_ddis) {
     cmScanDepInfo info;
     if (!cmScanDepFormat_P1689_Parse(arg_ddi, &info)) {
@@ -534,6 +534,7 @@ private:
   /// edge of the compilation DAG).
   std::unique_ptr<cmGeneratedFileStream> RulesFileStream;
   std::unique_ptr<cmGeneratedFileStream> CompileCommandsStream;
+  std::string CompileCommandsDirectory;
 
   /// The set of rules added to the generated build system.
   std::unordered_set<std::string> Rules;
@@ -67,6 +67,7 @@ void cmLinkLineComputer::ComputeLinkLibs(
 {
   using ItemVector = cmComputeLinkInformation::ItemVector;
   ItemVector const& items = cli.GetItems();
+  linkLibraries.reserve(linkLibraries.size() + items.size());
   for (auto const& item : items) {
     if (item.Target &&
         item.Target->GetType() == cmStateEnums::INTERFACE_LIBRARY) {
@@ -88,7 +89,7 @@ void cmLinkLineComputer::ComputeLinkLibs(
     }
     linkLib.Value += " ";
 
-    linkLibraries.emplace_back(linkLib);
+    linkLibraries.emplace_back(std::move(linkLib));
   }
 }
 
@@ -169,7 +170,7 @@ void cmLinkLineComputer::ComputeLinkPath(
     libDir.Value = cmStrCat(" ", libPathFlag,
                             this->ConvertToOutputForExisting(libDir.Value),
                             libPathTerminator, " ");
-    linkPath.emplace_back(libDir);
+    linkPath.emplace_back(std::move(libDir));
   }
 }
 
@@ -147,7 +147,7 @@ void cmLinkLineDeviceComputer::ComputeLinkLibraries(
         }
       }
 
-      linkLibraries.emplace_back(linkLib);
+      linkLibraries.emplace_back(std::move(linkLib));
     }
   }
 
@@ -222,15 +222,24 @@ bool HandleAppendCommand(std::vector<std::string> const& args,
 
   cmMakefile& makefile = status.GetMakefile();
   std::string const& listName = args[1];
-  // expand the variable
-  std::string listString;
-  GetListString(listString, listName, makefile);
+  cmProp oldValue = makefile.GetDefinition(listName);
 
-  // If `listString` or `args` is empty, no need to append `;`,
-  // then index is going to be `1` and points to the end-of-string ";"
-  auto const offset =
-    std::string::size_type(listString.empty() || args.empty());
-  listString += &";"[offset] + cmJoin(cmMakeRange(args).advance(2), ";");
+  // Build the new value in one buffer of the final size.
+  std::string::size_type size = oldValue ? oldValue->size() : 0;
+  for (std::string const& arg : cmMakeRange(args).advance(2)) {
+    size += arg.size() + 1;
+  }
+  std::string listString;
+  listString.reserve(size);
+  if (oldValue) {
+    listString = *oldValue;
+  }
+  for (std::string const& arg : cmMakeRange(args).advance(2)) {
+    if (!listString.empty() || &arg != &args[2]) {
+      listString += ';';
+    }
+    listString += arg;
+  }
 
   makefile.AddDefinition(listName, listString);
   return true;
@@ -1494,8 +1503,9 @@ bool FilterRegex(std::vector<std::string> const& args, bool includeMatches,
                  cmExecutionStatus& status)
 {
   const std::string& pattern = args[4];
-  cmsys::RegularExpression regex(pattern);
-  if (!regex.is_valid()) {
+  cmsys::RegularExpression* regex =
+    status.GetMakefile().GetCompiledRegex(pattern);
+  if (!regex) {
     std::string error =
       cmStrCat("sub-command FILTER, mode REGEX failed to compile regex \"",
                pattern, "\".");
@@ -1506,7 +1516,7 @@ bool FilterRegex(std::vector<std::string> const& args, bool includeMatches,
   auto argsBegin = varArgsExpanded.begin();
   auto argsEnd = varArgsExpanded.end();
   auto newArgsEnd =
-    std::remove_if(argsBegin, argsEnd, MatchesRegex(regex, includeMatches));
+    std::remove_if(argsBegin, argsEnd, MatchesRegex(*regex, includeMatches));
 
   std::string value = cmJoin(cmMakeRange(argsBegin, newArgsEnd), ";");
   status.GetMakefile().AddDefinition(listName, value);
@@ -11,6 +11,7 @@
 #  include <cmsys/Encoding.hxx>
 #endif
 
+#include "cmCryptoHash.h"
 #include "cmListFileLexer.h"
 #include "cmMessageType.h"
 #include "cmMessenger.h"
@@ -42,6 +43,7 @@ struct cmListFileParser
   std::string FunctionName;
   long FunctionLine;
   std::vector<cmListFileArgument> FunctionArguments;
+  bool IssuedWarning = false;
   enum
   {
     SeparationOkay,
@@ -200,6 +202,66 @@ bool cmListFile::ParseFile(const char* filename, cmMessenger* messenger,
   return !parseError;
 }
 
+bool cmListFileCache::ParseFile(std::string const& path,
+                                cmListFile& listFile, cmMessenger* messenger,
+                                cmListFileBacktrace const& lfbt)
+{
+  cmFileTime time;
+  bool const haveTime = time.Load(path);
+  auto it = this->Entries.find(path);
+  bool const seen =
+    haveTime && it != this->Entries.end() && it->second.Time.Equal(time);
+
+  // The modification time alone cannot tell whether the file was
+  // rewritten since it was cached because many filesystems record it
+  // with a resolution of one or two seconds.  Confirm with the content,
+  // hashed before parsing so that a concurrent rewrite is not missed.
+  std::vector<unsigned char> hash;
+  if (seen) {
+    cmCryptoHash hasher(cmCryptoHash::AlgoSHA256);
+    hash = hasher.ByteHashFile(path);
+    if (!hash.empty() && hash == it->second.Hash) {
+      listFile.Functions = it->second.Functions;
+      return true;
+    }
+  }
+
+  if (!cmSystemTools::FileExists(path) ||
+      cmSystemTools::FileIsDirectory(path)) {
+    return false;
+  }
+
+  bool parseError = false;
+  bool issuedWarning = false;
+  {
+    cmListFileParser parser(&listFile, lfbt, messenger);
+    parseError = !parser.ParseFile(path.c_str());
+    issuedWarning = parser.IssuedWarning;
+  }
+
+  // Only remember files that parse cleanly so that diagnostics are
+  // reported every time the file is read.
+  if (parseError || issuedWarning || !haveTime || (seen && hash.empty())) {
+    if (it != this->Entries.end()) {
+      this->Entries.erase(it);
+    }
+    return !parseError;
+  }
+
+  Entry& entry = this->Entries[path];
+  entry.Time = time;
+  if (!seen) {
+    // Most files are read only once.  Keep their content out of the
+    // cache until they are read again.
+    entry.Hash.clear();
+    entry.Functions.clear();
+    return true;
+  }
+  entry.Hash = std::move(hash);
+  entry.Functions = listFile.Functions;
+  return true;
+}
+
 bool cmListFile::ParseString(const char* str, const char* virtual_filename,
                              cmMessenger* messenger,
                              const cmListFileBacktrace& lfbt)
@@ -335,6 +397,7 @@ bool cmListFileParser::AddArgument(cmListFileLexer_Token* token,
     return false;
   }
   this->Messenger->IssueMessage(MessageType::AUTHOR_WARNING, m.str(), lfbt);
+  this->IssuedWarning = true;
   return true;
 }
 
@@ -8,21 +8,16 @@
 #include <iosfwd>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <cm/optional>
 
+#include "cmFileTime.h"
 #include "cmStateSnapshot.h"
 #include "cmSystemTools.h"
 
-/** \class cmListFileCache
- * \brief A class to cache list file contents.
- *
- * cmListFileCache is a class used to cache the contents of parsed
- * cmake list files.
- */
-
 class cmMessenger;
 
 struct cmCommandContext
@@ -60,6 +55,7 @@ struct cmListFileArgument
     : Value(std::move(v))
     , Delim(d)
     , Line(line)
+    , Literal(this->Value.find_first_of("$@\\") == std::string::npos)
   {
   }
   bool operator==(const cmListFileArgument& r) const
@@ -70,6 +66,9 @@ struct cmListFileArgument
   std::string Value;
   Delimiter Delim = Unquoted;
   long Line = 0;
+  // True if the value was known at construction to contain no variable
+  // references or escape sequences, so expansion would not change it.
+  bool Literal = false;
 };
 
 class cmListFileContext
@@ -279,3 +278,29 @@ struct cmListFile
 
   std::vector<cmListFileFunction> Functions;
 };
+
+/** \class cmListFileCache
+ * \brief A class to cache list file contents.
+ *
+ * cmListFileCache is a class used to cache the contents of parsed
+ * cmake list files.  A file that is read more than once during one
+ * run, such as a module included from many directories, is lexed and
+ * parsed again only if its modification time or content changes.  A
+ * file read only once is not hashed or kept.  Nothing is kept across
+ * runs.
+ */
+class cmListFileCache
+{
+public:
+  bool ParseFile(std::string const& path, cmListFile& listFile,
+                 cmMessenger* messenger, cmListFileBacktrace const& lfbt);
+
+private:
+  struct Entry
+  {
+    cmFileTime Time;
+    std::vector<unsigned char> Hash;
+    std::vector<cmListFileFunction> Functions;
+  };
+  std::unordered_map<std::string, Entry> Entries;
+};
@@ -104,6 +104,11 @@ void cmLocalCommonGenerator::ComputeObjectFilenames(
   // Determine if these object files should use a custom extension
   char const* custom_ext = gt->GetCustomObjectExtension();
   for (auto& si : mapping) {
+    // Names do not depend on the configuration, so entries computed
+    // for an earlier configuration can be kept.
+    if (!si.second.empty()) {
+      continue;
+    }
     cmSourceFile const* sf = si.first;
     bool keptSourceExtension;
     si.second = this->GetObjectFileNameWithoutTarget(
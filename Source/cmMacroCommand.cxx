@@ -91,7 +91,10 @@ bool cmMacroHelperCommand::operator()(
     for (cmListFileArgument const& k : func.Arguments()) {
       cmListFileArgument arg;
       arg.Value = k.Value;
-      if (k.Delim != cmListFileArgument::Bracket) {
+      // Every formal argument reference starts with "${", so arguments
+      // without one need no replacement scans at all.
+      if (k.Delim != cmListFileArgument::Bracket &&
+          arg.Value.find("${") != std::string::npos) {
         // replace formal arguments
         for (unsigned int j = 0; j < variables.size(); ++j) {
           cmSystemTools::ReplaceString(arg.Value, variables[j],
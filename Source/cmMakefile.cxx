@@ -274,6 +274,14 @@ void cmMakefile::PrintCommandTrace(
   cmListFileFunction const& lff,
   cm::optional<std::string> const& deferId) const
 {
+  // Check if current command is in the list of requested to trace...
+  std::vector<std::string> const& trace_only_these_commands =
+    this->GetCMakeInstance()->GetTraceCommands();
+  if (!trace_only_these_commands.empty() &&
+      !cm::contains(trace_only_these_commands, lff.LowerCaseName())) {
+    return;
+  }
+
   // Check if current file in the list of requested to trace...
   std::vector<std::string> const& trace_only_this_files =
     this->GetCMakeInstance()->GetTraceSources();
@@ -623,8 +631,8 @@ bool cmMakefile::ReadDependentFile(const std::string& filename,
   IncludeScope incScope(this, filenametoread, noPolicyScope);
 
   cmListFile listFile;
-  if (!listFile.ParseFile(filenametoread.c_str(), this->GetMessenger(),
-                          this->Backtrace)) {
+  if (!this->GetState()->GetListFileCache().ParseFile(
+        filenametoread, listFile, this->GetMessenger(), this->Backtrace)) {
     return false;
   }
 
@@ -724,8 +732,8 @@ bool cmMakefile::ReadListFile(const std::string& filename)
   ListFileScope scope(this, filenametoread);
 
   cmListFile listFile;
-  if (!listFile.ParseFile(filenametoread.c_str(), this->GetMessenger(),
-                          this->Backtrace)) {
+  if (!this->GetState()->GetListFileCache().ParseFile(
+        filenametoread, listFile, this->GetMessenger(), this->Backtrace)) {
     return false;
   }
 
@@ -1649,8 +1657,8 @@ void cmMakefile::Configure()
   this->AddDefinition("CMAKE_PARENT_LIST_FILE", currentStart);
 
   cmListFile listFile;
-  if (!listFile.ParseFile(currentStart.c_str(), this->GetMessenger(),
-                          this->Backtrace)) {
+  if (!this->GetState()->GetListFileCache().ParseFile(
+        currentStart, listFile, this->GetMessenger(), this->Backtrace)) {
     return;
   }
   if (this->IsRootMakefile()) {
@@ -3277,17 +3285,21 @@ bool cmMakefile::ExpandArguments(std::vector<cmListFileArgument> const& inArgs,
       outArgs.push_back(i.Value);
       continue;
     }
-    // Expand the variables in the argument.
-    value = i.Value;
-    this->ExpandVariablesInString(value, false, false, false, filename.c_str(),
-                                  i.Line, false, false);
+    // Expand the variables in the argument, if it has any.
+    std::string const* expanded = &i.Value;
+    if (!i.Literal) {
+      value = i.Value;
+      this->ExpandVariablesInString(value, false, false, false,
+                                    filename.c_str(), i.Line, false, false);
+      expanded = &value;
+    }
 
     // If the argument is quoted, it should be one argument.
     // Otherwise, it may be a list of arguments.
     if (i.Delim == cmListFileArgument::Quoted) {
-      outArgs.push_back(value);
+      outArgs.push_back(*expanded);
     } else {
-      cmExpandList(value, outArgs);
+      cmExpandList(*expanded, outArgs);
     }
   }
   return !cmSystemTools::GetFatalErrorOccured();
@@ -3306,17 +3318,21 @@ bool cmMakefile::ExpandArguments(
       outArgs.emplace_back(i.Value, true);
       continue;
     }
-    // Expand the variables in the argument.
-    value = i.Value;
-    this->ExpandVariablesInString(value, false, false, false, filename.c_str(),
-                                  i.Line, false, false);
+    // Expand the variables in the argument, if it has any.
+    std::string const* expanded = &i.Value;
+    if (!i.Literal) {
+      value = i.Value;
+      this->ExpandVariablesInString(value, false, false, false,
+                                    filename.c_str(), i.Line, false, false);
+      expanded = &value;
+    }
 
     // If the argument is quoted, it should be one argument.
     // Otherwise, it may be a list of arguments.
     if (i.Delim == cmListFileArgument::Quoted) {
-      outArgs.emplace_back(value, true);
+      outArgs.emplace_back(*expanded, true);
     } else {
-      std::vector<std::string> stringArgs = cmExpandedList(value);
+      std::vector<std::string> stringArgs = cmExpandedList(*expanded);
       for (std::string const& stringArg : stringArgs) {
         outArgs.emplace_back(stringArg, false);
       }
@@ -3648,9 +3664,12 @@ cmGlobalGenerator* cmMakefile::GetGlobalGenerator() const
 #ifndef CMAKE_BOOTSTRAP
 cmVariableWatch* cmMakefile::GetVariableWatch() const
 {
-  if (this->GetCMakeInstance() &&
-      this->GetCMakeInstance()->GetVariableWatch()) {
-    return this->GetCMakeInstance()->GetVariableWatch();
+  // Most runs watch no variables, so skip the per-access lookups.
+  if (this->GetCMakeInstance()) {
+    cmVariableWatch* vv = this->GetCMakeInstance()->GetVariableWatch();
+    if (vv && vv->HasWatches()) {
+      return vv;
+    }
   }
   return nullptr;
 }
@@ -4358,6 +4377,26 @@ void cmMakefile::StoreMatches(cmsys::RegularExpression& re)
   this->MarkVariableAsUsed(nMatchesVariable);
 }
 
+cmsys::RegularExpression* cmMakefile::GetCompiledRegex(
+  std::string const& pattern)
+{
+  auto i = this->CompiledRegexes.find(pattern);
+  if (i != this->CompiledRegexes.end()) {
+    return &i->second;
+  }
+
+  // Bound the cache so generated patterns cannot grow it without limit.
+  if (this->CompiledRegexes.size() >= 256) {
+    this->CompiledRegexes.clear();
+  }
+  i = this->CompiledRegexes.emplace(pattern, cmsys::RegularExpression()).first;
+  if (!i->second.compile(pattern)) {
+    this->CompiledRegexes.erase(i);
+    return nullptr;
+  }
+  return &i->second;
+}
+
 cmStateSnapshot cmMakefile::GetStateSnapshot() const
 {
   return this->StateSnapshot;
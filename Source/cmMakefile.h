@@ -687,7 +687,7 @@ public:
 
 /**
  * Get the variable watch. This is used to determine when certain variables
- * are accessed.
+ * are accessed.  Returns null when no variable is being watched.
  */
 #ifndef CMAKE_BOOTSTRAP
   cmVariableWatch* GetVariableWatch() const;
@@ -892,6 +892,14 @@ public:
   void ClearMatches();
   void StoreMatches(cmsys::RegularExpression& re);
 
+  /**
+   * Get a compiled regular expression for the given pattern, or
+   * nullptr if it does not compile.  The object is owned by this
+   * makefile and reused by later requests for the same pattern, so
+   * it is only valid until the next call.
+   */
+  cmsys::RegularExpression* GetCompiledRegex(std::string const& pattern);
+
   cmStateSnapshot GetStateSnapshot() const;
 
   const char* GetDefineFlagsCMP0059() const;
@@ -1032,6 +1040,8 @@ private:
   mutable cmsys::RegularExpression cmAtVarRegex;
   mutable cmsys::RegularExpression cmNamedCurly;
 
+  std::unordered_map<std::string, cmsys::RegularExpression> CompiledRegexes;
+
   std::vector<cmMakefile*> UnConfiguredDirectories;
   std::vector<std::unique_ptr<cmExportBuildFileGenerator>>
     ExportBuildFileGenerators;
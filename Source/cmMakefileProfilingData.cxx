@@ -2,6 +2,7 @@
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #include "cmMakefileProfilingData.h"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 #include <vector>
@@ -17,7 +18,8 @@
 #include "cmSystemTools.h"
 
 cmMakefileProfilingData::cmMakefileProfilingData(
-  const std::string& profileStream)
+  const std::string& profileStream, Format format)
+  : OutputFormat(format)
 {
   std::ios::openmode omode = std::ios::out | std::ios::trunc;
   this->ProfileStream.open(profileStream.c_str(), omode);
@@ -28,14 +30,20 @@ cmMakefileProfilingData::cmMakefileProfilingData(
     throw std::runtime_error(std::string("Unable to open: ") + profileStream);
   }
 
-  this->ProfileStream << "[";
+  if (this->OutputFormat == Format::GoogleTrace) {
+    this->ProfileStream << "[";
+  }
 };
 
 cmMakefileProfilingData::~cmMakefileProfilingData() noexcept
 {
   if (this->ProfileStream.good()) {
     try {
-      this->ProfileStream << "]";
+      if (this->OutputFormat == Format::CollapsedStacks) {
+        this->WriteCollapsedStacks();
+      } else {
+        this->ProfileStream << "]";
+      }
       this->ProfileStream.close();
     } catch (...) {
       cmSystemTools::Error("Error writing profiling output!");
@@ -51,6 +59,22 @@ void cmMakefileProfilingData::StartEntry(const cmListFileFunction& lff,
     return;
   }
 
+  if (this->OutputFormat == Format::CollapsedStacks) {
+    Frame frame;
+    std::string name = cmStrCat(lff.LowerCaseName(), " (", lfc.FilePath, ':',
+                                lfc.Line, ')');
+    // Semicolons separate frames in the output.
+    std::replace(name.begin(), name.end(), ';', ',');
+    if (this->Frames.empty()) {
+      frame.Stack = std::move(name);
+    } else {
+      frame.Stack = cmStrCat(this->Frames.back().Stack, ';', name);
+    }
+    frame.Start = Clock::now();
+    this->Frames.emplace_back(std::move(frame));
+    return;
+  }
+
   try {
     if (this->ProfileStream.tellp() > 1) {
       this->ProfileStream << ",";
@@ -93,6 +117,23 @@ void cmMakefileProfilingData::StopEntry()
     return;
   }
 
+  if (this->OutputFormat == Format::CollapsedStacks) {
+    if (this->Frames.empty()) {
+      return;
+    }
+    Frame& frame = this->Frames.back();
+    Clock::duration const elapsed = Clock::now() - frame.Start;
+    Clock::duration const exclusive = elapsed - frame.Children;
+    this->ExclusiveTimes[frame.Stack] += static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(exclusive)
+        .count());
+    this->Frames.pop_back();
+    if (!this->Frames.empty()) {
+      this->Frames.back().Children += elapsed;
+    }
+    return;
+  }
+
   try {
     this->ProfileStream << ",";
     cmsys::SystemInformation info;
@@ -112,3 +153,10 @@ void cmMakefileProfilingData::StopEntry()
     cmSystemTools::Error("Error writing profiling output!");
   }
 }
+
+void cmMakefileProfilingData::WriteCollapsedStacks()
+{
+  for (auto const& entry : this->ExclusiveTimes) {
+    this->ProfileStream << entry.first << ' ' << entry.second << '\n';
+  }
+}
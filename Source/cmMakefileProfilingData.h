@@ -1,8 +1,12 @@
 /* Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
    file Copyright.txt or https://cmake.org/licensing for details.  */
 #pragma once
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cmsys/FStream.hxx"
 
@@ -16,12 +20,36 @@ class cmListFileFunction;
 class cmMakefileProfilingData
 {
 public:
-  cmMakefileProfilingData(const std::string&);
+  enum class Format
+  {
+    // One begin and one end event per command in Google Trace Format.
+    GoogleTrace,
+    // Exclusive time per call stack, aggregated in memory and written as
+    // collapsed stacks (one "frame;frame;frame microseconds" line each).
+    CollapsedStacks,
+  };
+
+  cmMakefileProfilingData(const std::string&,
+                          Format format = Format::GoogleTrace);
   ~cmMakefileProfilingData() noexcept;
   void StartEntry(const cmListFileFunction& lff, cmListFileContext const& lfc);
   void StopEntry();
 
 private:
+  void WriteCollapsedStacks();
+
+  using Clock = std::chrono::steady_clock;
+  struct Frame
+  {
+    // Names of all frames from the bottom of the stack up to this one.
+    std::string Stack;
+    Clock::time_point Start;
+    Clock::duration Children = Clock::duration::zero();
+  };
+
+  Format OutputFormat;
   cmsys::ofstream ProfileStream;
   std::unique_ptr<Json::StreamWriter> JsonWriter;
+  std::vector<Frame> Frames;
+  std::map<std::string, std::uint64_t> ExclusiveTimes;
 };
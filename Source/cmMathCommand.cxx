@@ -33,6 +33,55 @@ bool cmMathCommand(std::vector<std::string> const& args,
 }
 
 namespace {
+// Parse a decimal operand surrounded by optional blanks.  Operands are
+// limited to 18 digits so that the sum or difference of two of them
+// cannot overflow.
+bool ParseSimpleOperand(const char*& c, KWIML_INT_int64_t& value)
+{
+  while (*c == ' ' || *c == '\t') {
+    ++c;
+  }
+  const char* first = c;
+  value = 0;
+  while (*c >= '0' && *c <= '9') {
+    value = value * 10 + (*c - '0');
+    ++c;
+  }
+  if (c == first || c - first > 18) {
+    return false;
+  }
+  while (*c == ' ' || *c == '\t') {
+    ++c;
+  }
+  return true;
+}
+
+// Evaluate the "<a>", "<a> + <b>" and "<a> - <b>" forms used by
+// counters in loops without running the full expression parser.
+bool EvaluateSimpleExpr(std::string const& expression,
+                        KWIML_INT_int64_t& result)
+{
+  const char* c = expression.c_str();
+  KWIML_INT_int64_t lhs;
+  if (!ParseSimpleOperand(c, lhs)) {
+    return false;
+  }
+  if (*c == '\0') {
+    result = lhs;
+    return true;
+  }
+  char const op = *c++;
+  if (op != '+' && op != '-') {
+    return false;
+  }
+  KWIML_INT_int64_t rhs;
+  if (!ParseSimpleOperand(c, rhs) || *c != '\0') {
+    return false;
+  }
+  result = op == '+' ? lhs + rhs : lhs - rhs;
+  return true;
+}
+
 bool HandleExprCommand(std::vector<std::string> const& args,
                        cmExecutionStatus& status)
 {
@@ -89,10 +138,14 @@ bool HandleExprCommand(std::vector<std::string> const& args,
     outputFormat = NumericFormat::DECIMAL;
   }
 
+  KWIML_INT_int64_t result;
   cmExprParserHelper helper;
-  if (!helper.ParseString(expression.c_str(), 0)) {
-    status.SetError(helper.GetError());
-    return false;
+  if (!EvaluateSimpleExpr(expression, result)) {
+    if (!helper.ParseString(expression.c_str(), 0)) {
+      status.SetError(helper.GetError());
+      return false;
+    }
+    result = helper.GetResult();
   }
 
   char buffer[1024];
@@ -107,7 +160,7 @@ bool HandleExprCommand(std::vector<std::string> const& args,
       fmt = "%" KWIML_INT_PRId64;
       break;
   }
-  sprintf(buffer, fmt, helper.GetResult());
+  sprintf(buffer, fmt, result);
 
   std::string const& w = helper.GetWarning();
   if (!w.empty()) {
@@ -63,11 +63,12 @@ public:
 
   void FindConflicts(unsigned int index)
   {
+    // Look up the real path of the entry's directory only once.
+    std::string const& realDir = this->OD->GetRealPath(this->Directory);
     for (unsigned int i = 0; i < this->OD->OriginalDirectories.size(); ++i) {
       // Check if this directory conflicts with the entry.
       std::string const& dir = this->OD->OriginalDirectories[i];
-      if (!this->OD->IsSameDirectory(dir, this->Directory) &&
-          this->FindConflict(dir)) {
+      if (this->OD->GetRealPath(dir) != realDir && this->FindConflict(dir)) {
         // The library will be found in this directory but this is not
         // the directory named for it.  Add an entry to make sure the
         // desired directory comes before this one.
@@ -80,11 +81,10 @@ public:
   void FindImplicitConflicts(std::ostringstream& w)
   {
     bool first = true;
+    std::string const& realDir = this->OD->GetRealPath(this->Directory);
     for (std::string const& dir : this->OD->OriginalDirectories) {
       // Check if this directory conflicts with the entry.
-      if (dir != this->Directory &&
-          cmSystemTools::GetRealPath(dir) !=
-            cmSystemTools::GetRealPath(this->Directory) &&
+      if (dir != this->Directory && this->OD->GetRealPath(dir) != realDir &&
           this->FindConflict(dir)) {
         // The library will be found in this directory but it is
         // supposed to be found in an implicit search directory.
@@ -545,12 +545,6 @@ void cmOrderDirectories::DiagnoseCycle()
     MessageType::WARNING, e.str(), this->Target->GetBacktrace());
 }
 
-bool cmOrderDirectories::IsSameDirectory(std::string const& l,
-                                         std::string const& r)
-{
-  return this->GetRealPath(l) == this->GetRealPath(r);
-}
-
 std::string const& cmOrderDirectories::GetRealPath(std::string const& dir)
 {
   auto i = this->RealPaths.lower_bound(dir);
@@ -83,9 +83,6 @@ private:
   };
   std::vector<ConflictList> ConflictGraph;
 
-  // Compare directories after resolving symlinks.
-  bool IsSameDirectory(std::string const& l, std::string const& r);
-
   bool IsImplicitDirectory(std::string const& dir);
 
   std::string const& GetRealPath(std::string const& dir);
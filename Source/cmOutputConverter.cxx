@@ -6,6 +6,7 @@
 #include <cassert>
 #include <cctype>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "cmState.h"
@@ -120,11 +121,21 @@ std::string cmOutputConverter::ConvertToOutputForExisting(
   // already exists, we can use a short-path to reference it without a
   // space.
   if (this->GetState()->UseWindowsShell() &&
-      remote.find_first_of(" #") != std::string::npos &&
-      cmSystemTools::FileExists(remote)) {
-    std::string tmp;
-    if (cmSystemTools::GetShortPath(remote, tmp)) {
-      return this->ConvertToOutputFormat(tmp, format);
+      remote.find_first_of(" #") != std::string::npos) {
+    // Probing the file system is expensive and the same paths are
+    // converted for every target and language, so remember the result.
+    auto i = this->ShortPaths.lower_bound(remote);
+    if (i == this->ShortPaths.end() ||
+        this->ShortPaths.key_comp()(remote, i->first)) {
+      std::string tmp;
+      if (!cmSystemTools::FileExists(remote) ||
+          !cmSystemTools::GetShortPath(remote, tmp)) {
+        tmp.clear();
+      }
+      i = this->ShortPaths.emplace_hint(i, remote, std::move(tmp));
+    }
+    if (!i->second.empty()) {
+      return this->ConvertToOutputFormat(i->second, format);
     }
   }
 
@@ -460,6 +471,16 @@ bool cmOutputConverter::Shell_ArgumentNeedsQuotes(cm::string_view in,
 
 std::string cmOutputConverter::Shell_GetArgument(cm::string_view in, int flags)
 {
+  /* Whether the argument must be quoted.  */
+  int needQuotes = Shell_ArgumentNeedsQuotes(in, flags);
+
+  /* Most arguments have no character that needs quoting or escaping
+     for any shell or make tool, so they can be copied as-is.  */
+  if (!needQuotes &&
+      in.find_first_of("\\\"`$#%;") == cm::string_view::npos) {
+    return std::string(in);
+  }
+
   /* Output will be at least as long as input string.  */
   std::string out;
   out.reserve(in.size());
@@ -467,8 +488,6 @@ std::string cmOutputConverter::Shell_GetArgument(cm::string_view in, int flags)
   /* Keep track of how many backslashes have been encountered in a row.  */
   int windows_backslashes = 0;
 
-  /* Whether the argument must be quoted.  */
-  int needQuotes = Shell_ArgumentNeedsQuotes(in, flags);
   if (needQuotes) {
     /* Add the opening quote for this argument.  */
     if (flags & Shell_Flag_WatcomQuote) {
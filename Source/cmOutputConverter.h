@@ -4,6 +4,7 @@
 
 #include "cmConfigure.h" // IWYU pragma: keep
 
+#include <map>
 #include <string>
 
 #include <cm/string_view>
@@ -131,6 +132,10 @@ private:
 
   bool LinkScriptShell;
 
+  // Short paths already looked up by ConvertToOutputForExisting.
+  // An empty value means the path has no usable short form.
+  mutable std::map<std::string, std::string> ShortPaths;
+
   // The top-most directories for relative path conversion.  Both the
   // source and destination location of a relative path conversion
   // must be underneath one of these directories (both under source or
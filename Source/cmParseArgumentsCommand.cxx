@@ -4,7 +4,6 @@
 
 #include <map>
 #include <set>
-#include <sstream>
 #include <utility>
 
 #include <cm/string_view>
@@ -193,14 +192,14 @@ bool cmParseArgumentsCommand(std::vector<std::string> const& args,
       cmSystemTools::SetFatalErrorOccured();
       return true;
     }
+    list.reserve(count > argvStart ? count - argvStart : 0);
     for (unsigned long i = argvStart; i < count; ++i) {
-      std::ostringstream argName;
-      argName << "ARGV" << i;
-      cmProp arg = status.GetMakefile().GetDefinition(argName.str());
+      std::string const argName = cmStrCat("ARGV", i);
+      cmProp arg = status.GetMakefile().GetDefinition(argName);
       if (!arg) {
         status.GetMakefile().IssueMessage(MessageType::FATAL_ERROR,
                                           "PARSE_ARGV called with " +
-                                            argName.str() + " not set");
+                                            argName + " not set");
         cmSystemTools::SetFatalErrorOccured();
         return true;
       }
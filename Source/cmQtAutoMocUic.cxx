@@ -961,12 +961,19 @@ void cmQtAutoMocUicT::JobParseT::MocMacro()
 {
   for (KeyExpT const& filter : this->MocConst().MacroFilters) {
     // Run a simple find string check
-    if (this->Content.find(filter.Key) == std::string::npos) {
+    std::string::size_type const keyPos = this->Content.find(filter.Key);
+    if (keyPos == std::string::npos) {
       continue;
     }
-    // Run the expensive regular expression check loop
+    // A match starts at the newline preceding the macro name, so the
+    // expensive regular expression check can skip everything before
+    // the line of the first occurrence.
+    std::string::size_type start = this->Content.rfind('\n', keyPos);
+    if (start == std::string::npos) {
+      start = keyPos;
+    }
     cmsys::RegularExpressionMatch match;
-    if (filter.Exp.find(this->Content.c_str(), match)) {
+    if (filter.Exp.find(this->Content.c_str() + start, match)) {
       // Keep detected macro name
       this->FileHandle->ParseData->Moc.Macro = filter.Key;
       return;
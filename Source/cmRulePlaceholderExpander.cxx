@@ -353,6 +353,7 @@ void cmRulePlaceholderExpander::ExpandRuleVariables(
   }
   std::string::size_type pos = 0;
   std::string expandedInput;
+  expandedInput.reserve(s.size());
   while (start != std::string::npos && start < s.size() - 2) {
     std::string::size_type end = s.find('>', start);
     // if we find a < with no > we are done
@@ -369,7 +370,7 @@ void cmRulePlaceholderExpander::ExpandRuleVariables(
       std::string var = s.substr(start + 1, end - start - 1);
       std::string replace =
         this->ExpandRuleVariable(outputConverter, var, replaceValues);
-      expandedInput += s.substr(pos, start - pos);
+      expandedInput.append(s, pos, start - pos);
 
       // Prevent consecutive whitespace in the output if the rule variable
       // expands to an empty string.
@@ -387,6 +388,6 @@ void cmRulePlaceholderExpander::ExpandRuleVariables(
     }
   }
   // add the rest of the input
-  expandedInput += s.substr(pos, s.size() - pos);
-  s = expandedInput;
+  expandedInput.append(s, pos, std::string::npos);
+  s = std::move(expandedInput);
 }
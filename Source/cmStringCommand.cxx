@@ -240,14 +240,16 @@ bool RegexMatch(std::vector<std::string> const& args,
 
   status.GetMakefile().ClearMatches();
   // Compile the regular expression.
-  cmsys::RegularExpression re;
-  if (!re.compile(regex)) {
+  cmsys::RegularExpression* compiled =
+    status.GetMakefile().GetCompiledRegex(regex);
+  if (!compiled) {
     std::string e =
       "sub-command REGEX, mode MATCH failed to compile regex \"" + regex +
       "\".";
     status.SetError(e);
     return false;
   }
+  cmsys::RegularExpression& re = *compiled;
 
   // Concatenate all the last arguments together.
   std::string input = cmJoin(cmMakeRange(args).advance(4), std::string());
@@ -282,14 +284,16 @@ bool RegexMatchAll(std::vector<std::string> const& args,
 
   status.GetMakefile().ClearMatches();
   // Compile the regular expression.
-  cmsys::RegularExpression re;
-  if (!re.compile(regex)) {
+  cmsys::RegularExpression* compiled =
+    status.GetMakefile().GetCompiledRegex(regex);
+  if (!compiled) {
     std::string e =
       "sub-command REGEX, mode MATCHALL failed to compile regex \"" + regex +
       "\".";
     status.SetError(e);
     return false;
   }
+  cmsys::RegularExpression& re = *compiled;
 
   // Concatenate all the last arguments together.
   std::string input = cmJoin(cmMakeRange(args).advance(4), std::string());
@@ -2234,6 +2234,29 @@ static std::string cmSystemToolsCMakeGUICommand;
 static std::string cmSystemToolsCMClDepsCommand;
 static std::string cmSystemToolsCMakeRoot;
 static std::string cmSystemToolsHTMLDoc;
+static bool cmSystemToolsOptionalToolsChecked = false;
+
+static void cmSystemToolsCheckOptionalTool(std::string& tool)
+{
+  if (!tool.empty() && !cmSystemTools::FileExists(tool)) {
+    tool.clear();
+  }
+}
+
+// The optional tools are needed only by a few code paths, so check
+// that they exist on first use instead of on every startup.  This
+// keeps short-lived "cmake -E" invocations from paying for the lookups.
+static void cmSystemToolsCheckOptionalTools()
+{
+  if (cmSystemToolsOptionalToolsChecked) {
+    return;
+  }
+  cmSystemToolsOptionalToolsChecked = true;
+  cmSystemToolsCheckOptionalTool(cmSystemToolsCMakeGUICommand);
+  cmSystemToolsCheckOptionalTool(cmSystemToolsCMakeCursesCommand);
+  cmSystemToolsCheckOptionalTool(cmSystemToolsCMClDepsCommand);
+}
+
 void cmSystemTools::FindCMakeResources(const char* argv0)
 {
   std::string exe_dir;
@@ -2305,19 +2328,11 @@ void cmSystemTools::FindCMakeResources(const char* argv0)
     cmStrCat(exe_dir, "/cpack", cmSystemTools::GetExecutableExtension());
   cmSystemToolsCMakeGUICommand =
     cmStrCat(exe_dir, "/cmake-gui", cmSystemTools::GetExecutableExtension());
-  if (!cmSystemTools::FileExists(cmSystemToolsCMakeGUICommand)) {
-    cmSystemToolsCMakeGUICommand.clear();
-  }
   cmSystemToolsCMakeCursesCommand =
     cmStrCat(exe_dir, "/ccmake", cmSystemTools::GetExecutableExtension());
-  if (!cmSystemTools::FileExists(cmSystemToolsCMakeCursesCommand)) {
-    cmSystemToolsCMakeCursesCommand.clear();
-  }
   cmSystemToolsCMClDepsCommand =
     cmStrCat(exe_dir, "/cmcldeps", cmSystemTools::GetExecutableExtension());
-  if (!cmSystemTools::FileExists(cmSystemToolsCMClDepsCommand)) {
-    cmSystemToolsCMClDepsCommand.clear();
-  }
+  cmSystemToolsOptionalToolsChecked = false;
 
 #ifndef CMAKE_BOOTSTRAP
   // Install tree has
@@ -2383,16 +2398,19 @@ std::string const& cmSystemTools::GetCPackCommand()
 
 std::string const& cmSystemTools::GetCMakeCursesCommand()
 {
+  cmSystemToolsCheckOptionalTools();
   return cmSystemToolsCMakeCursesCommand;
 }
 
 std::string const& cmSystemTools::GetCMakeGUICommand()
 {
+  cmSystemToolsCheckOptionalTools();
   return cmSystemToolsCMakeGUICommand;
 }
 
 std::string const& cmSystemTools::GetCMClDepsCommand()
 {
+  cmSystemToolsCheckOptionalTools();
   return cmSystemToolsCMClDepsCommand;
 }
 
@@ -40,6 +40,11 @@ public:
   bool VariableAccessed(const std::string& variable, int access_type,
                         const char* newValue, const cmMakefile* mf) const;
 
+  /**
+   * Return whether any variable is watched at all
+   */
+  bool HasWatches() const { return !this->WatchMap.empty(); }
+
   /**
    * Different access types.
    */
@@ -1626,11 +1626,15 @@ void cmVisualStudio10TargetGenerator::WriteGroups()
   std::vector<cmGeneratorTarget::AllConfigSource> const& sources =
     this->GeneratorTarget->GetAllConfigSources();
 
+  // Remember the group of each source so the regex search below is
+  // not repeated while writing the per-tool item groups.
+  SourceGroupMap sourceGroupOf;
   std::set<cmSourceGroup const*> groupsUsed;
   for (cmGeneratorTarget::AllConfigSource const& si : sources) {
     std::string const& source = si.Source->GetFullPath();
     cmSourceGroup* sourceGroup =
       this->Makefile->FindSourceGroup(source, sourceGroups);
+    sourceGroupOf.emplace(si.Source, sourceGroup);
     groupsUsed.insert(sourceGroup);
   }
 
@@ -1639,6 +1643,7 @@ void cmVisualStudio10TargetGenerator::WriteGroups()
     std::string const& source = srcCMakeLists->GetFullPath();
     cmSourceGroup* sourceGroup =
       this->Makefile->FindSourceGroup(source, sourceGroups);
+    sourceGroupOf.emplace(srcCMakeLists, sourceGroup);
     groupsUsed.insert(sourceGroup);
   }
 
@@ -1662,7 +1667,8 @@ void cmVisualStudio10TargetGenerator::WriteGroups()
                  "http://schemas.microsoft.com/developer/msbuild/2003");
 
     for (auto const& ti : this->Tools) {
-      this->WriteGroupSources(e0, ti.first, ti.second, sourceGroups);
+      this->WriteGroupSources(e0, ti.first, ti.second, sourceGroups,
+                              sourceGroupOf);
     }
 
     // Added files are images and the manifest.
@@ -1779,15 +1785,17 @@ void cmVisualStudio10TargetGenerator::AddMissingSourceGroups(
 
 void cmVisualStudio10TargetGenerator::WriteGroupSources(
   Elem& e0, std::string const& name, ToolSources const& sources,
-  std::vector<cmSourceGroup>& sourceGroups)
+  std::vector<cmSourceGroup>& sourceGroups, SourceGroupMap& sourceGroupOf)
 {
   Elem e1(e0, "ItemGroup");
   e1.SetHasElements();
   for (ToolSource const& s : sources) {
     cmSourceFile const* sf = s.SourceFile;
     std::string const& source = sf->GetFullPath();
-    cmSourceGroup* sourceGroup =
-      this->Makefile->FindSourceGroup(source, sourceGroups);
+    cmSourceGroup*& sourceGroup = sourceGroupOf[sf];
+    if (!sourceGroup) {
+      sourceGroup = this->Makefile->FindSourceGroup(source, sourceGroups);
+    }
     std::string const& filter = sourceGroup->GetFullName();
     std::string path = this->ConvertPath(source, s.RelativePath);
     ConvertToWindowsSlash(path);
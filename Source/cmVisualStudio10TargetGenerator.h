@@ -171,9 +171,12 @@ private:
   void WriteEvent(Elem& e1, std::string const& name,
                   std::vector<cmCustomCommand> const& commands,
                   std::string const& configName);
+  using SourceGroupMap =
+    std::unordered_map<cmSourceFile const*, cmSourceGroup*>;
   void WriteGroupSources(Elem& e0, std::string const& name,
                          ToolSources const& sources,
-                         std::vector<cmSourceGroup>&);
+                         std::vector<cmSourceGroup>&,
+                         SourceGroupMap& sourceGroupOf);
   void AddMissingSourceGroups(std::set<cmSourceGroup const*>& groupsUsed,
                               const std::vector<cmSourceGroup>& allGroups);
   bool IsResxHeader(const std::string& headerFile);
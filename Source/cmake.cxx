@@ -37,6 +37,7 @@
 #include "cmDocumentationFormatter.h"
 #include "cmDuration.h"
 #include "cmExternalMakefileProjectGenerator.h"
+#include "cmFileTime.h"
 #include "cmFileTimeCache.h"
 #include "cmGeneratorTarget.h"
 #include "cmGlobalGenerator.h"
@@ -999,6 +1000,12 @@ void cmake::SetArgs(const std::vector<std::string>& args)
                        state->SetTrace(true);
                        return true;
                      } },
+    CommandArgument{ "--trace-command", CommandArgument::Values::One,
+                     [](std::string const& value, cmake* state) -> bool {
+                       state->AddTraceCommand(cmSystemTools::LowerCase(value));
+                       state->SetTrace(true);
+                       return true;
+                     } },
     CommandArgument{ "--trace-redirect", CommandArgument::Values::One,
                      [](std::string const& value, cmake* state) -> bool {
                        std::string file(value);
@@ -1169,19 +1176,22 @@ void cmake::SetArgs(const std::vector<std::string>& args)
         "--profiling-format specified but no --profiling-output!");
       return;
     }
+    cmMakefileProfilingData::Format format;
     if (profilingFormat == "google-trace"_s) {
-      try {
-        this->ProfilingOutput =
-          cm::make_unique<cmMakefileProfilingData>(profilingOutput);
-      } catch (std::runtime_error& e) {
-        cmSystemTools::Error(
-          cmStrCat("Could not start profiling: ", e.what()));
-        return;
-      }
+      format = cmMakefileProfilingData::Format::GoogleTrace;
+    } else if (profilingFormat == "collapsed-stacks"_s) {
+      format = cmMakefileProfilingData::Format::CollapsedStacks;
     } else {
       cmSystemTools::Error("Invalid format specified for --profiling-format");
       return;
     }
+    try {
+      this->ProfilingOutput =
+        cm::make_unique<cmMakefileProfilingData>(profilingOutput, format);
+    } catch (std::runtime_error& e) {
+      cmSystemTools::Error(cmStrCat("Could not start profiling: ", e.what()));
+      return;
+    }
   }
 #endif
 
@@ -2816,55 +2826,51 @@ int cmake::CheckBuildSystem()
     return 1;
   }
 
-  // Find the newest dependency.
-  auto dep = depends.begin();
-  std::string dep_newest = *dep++;
-  for (; dep != depends.end(); ++dep) {
-    int result = 0;
-    if (this->FileTimeCache->Compare(dep_newest, *dep, &result)) {
-      if (result < 0) {
-        dep_newest = *dep;
-      }
-    } else {
+  // Find the newest dependency.  Load each file time only once.
+  std::string const* dep_newest = nullptr;
+  cmFileTime dep_newest_time;
+  for (std::string const& dep : depends) {
+    cmFileTime dep_time;
+    if (!this->FileTimeCache->Load(dep, dep_time)) {
       if (verbose) {
         cmSystemTools::Stdout(
           "Re-run cmake: build system dependency is missing\n");
       }
       return 1;
     }
+    if (!dep_newest || dep_newest_time.Older(dep_time)) {
+      dep_newest = &dep;
+      dep_newest_time = dep_time;
+    }
   }
 
   // Find the oldest output.
-  auto out = outputs.begin();
-  std::string out_oldest = *out++;
-  for (; out != outputs.end(); ++out) {
-    int result = 0;
-    if (this->FileTimeCache->Compare(out_oldest, *out, &result)) {
-      if (result > 0) {
-        out_oldest = *out;
-      }
-    } else {
+  std::string const* out_oldest = nullptr;
+  cmFileTime out_oldest_time;
+  for (std::string const& out : outputs) {
+    cmFileTime out_time;
+    if (!this->FileTimeCache->Load(out, out_time)) {
       if (verbose) {
         cmSystemTools::Stdout(
           "Re-run cmake: build system output is missing\n");
       }
       return 1;
     }
+    if (!out_oldest || out_oldest_time.Newer(out_time)) {
+      out_oldest = &out;
+      out_oldest_time = out_time;
+    }
   }
 
   // If any output is older than any dependency then rerun.
-  {
-    int result = 0;
-    if (!this->FileTimeCache->Compare(out_oldest, dep_newest, &result) ||
-        result < 0) {
-      if (verbose) {
-        std::ostringstream msg;
-        msg << "Re-run cmake file: " << out_oldest
-            << " older than: " << dep_newest << "\n";
-        cmSystemTools::Stdout(msg.str());
-      }
-      return 1;
+  if (out_oldest_time.Older(dep_newest_time)) {
+    if (verbose) {
+      std::ostringstream msg;
+      msg << "Re-run cmake file: " << *out_oldest
+          << " older than: " << *dep_newest << "\n";
+      cmSystemTools::Stdout(msg.str());
     }
+    return 1;
   }
 
   // No need to rerun.
@@ -486,6 +486,14 @@ public:
   {
     return this->TraceOnlyThisSources;
   }
+  void AddTraceCommand(std::string const& name)
+  {
+    this->TraceOnlyThisCommands.push_back(name);
+  }
+  std::vector<std::string> const& GetTraceCommands() const
+  {
+    return this->TraceOnlyThisCommands;
+  }
   cmGeneratedFileStream& GetTraceFile() { return this->TraceFile; }
   void SetTraceFile(std::string const& file);
   void PrintTraceFormatVersion();
@@ -686,6 +694,7 @@ private:
   std::unique_ptr<cmMessenger> Messenger;
 
   std::vector<std::string> TraceOnlyThisSources;
+  std::vector<std::string> TraceOnlyThisCommands;
 
   LogLevel MessageLogLevel = LogLevel::LOG_STATUS;
   bool LogLevelWasSetViaCLI = false;
@@ -0,0 +1,31 @@
+enable_language(Fortran)
+
+add_executable(main
+  ${CMAKE_CURRENT_BINARY_DIR}/src/main.f90
+  ${CMAKE_CURRENT_BINARY_DIR}/src/other.f90
+  )
+target_include_directories(main PRIVATE ${CMAKE_CURRENT_BINARY_DIR}/inc)
+
+set(scan_file "${CMAKE_CURRENT_BINARY_DIR}/CMakeFiles/main.dir/fortran.scan")
+file(GENERATE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/check-$<LOWER_CASE:$<CONFIG>>.cmake CONTENT "
+set(check_pairs
+  \"$<TARGET_FILE:main>|${CMAKE_CURRENT_BINARY_DIR}/src/main.f90\"
+  )
+set(check_exes
+  \"$<TARGET_FILE:main>\"
+  )
+if(check_step EQUAL 3)
+  set(expect_found \"src/value\\\\.inc\")
+else()
+  set(expect_found \"inc/value\\\\.inc\")
+endif()
+file(STRINGS \"${scan_file}\" found REGEX \"^lookup-found .*value\\\\.inc$\")
+if(NOT found MATCHES \"^lookup-found (.*/)?\${expect_found}$\")
+  string(APPEND RunCMake_TEST_FAILED \"
+ '${scan_file}' records lookup result
+  \${found}
+ but expected one matching
+  \${expect_found}
+\")
+endif()
+")
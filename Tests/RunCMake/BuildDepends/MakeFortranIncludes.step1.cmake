@@ -0,0 +1,15 @@
+file(WRITE "${RunCMake_TEST_BINARY_DIR}/src/main.f90" [[
+program main
+  use other_mod
+  include 'value.inc'
+  call exit(value + offset)
+end program main
+]])
+file(WRITE "${RunCMake_TEST_BINARY_DIR}/src/other.f90" [[
+module other_mod
+  integer, parameter :: offset = 0
+end module other_mod
+]])
+file(WRITE "${RunCMake_TEST_BINARY_DIR}/inc/value.inc" [[
+  integer, parameter :: value = 1
+]])
@@ -0,0 +1,4 @@
+# Change the included file.  The scan of other.f90 is reused.
+file(WRITE "${RunCMake_TEST_BINARY_DIR}/inc/value.inc" [[
+  integer, parameter :: value = 2
+]])
@@ -0,0 +1,8 @@
+# Add a file next to main.f90 that is now found before the one in the
+# include directory.  No file already scanned for main.f90 changed, so
+# only repeating the include lookup notices it.  Touch other.f90 to
+# make the target scan its dependencies again.
+file(WRITE "${RunCMake_TEST_BINARY_DIR}/src/value.inc" [[
+  integer, parameter :: value = 3
+]])
+file(TOUCH "${RunCMake_TEST_BINARY_DIR}/src/other.f90")
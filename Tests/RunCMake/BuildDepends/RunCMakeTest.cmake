@@ -183,6 +183,12 @@ if(RunCMake_GENERATOR MATCHES "Make")
   run_BuildDepends(MakeDependencies)
 endif()
 
+if(RunCMake_GENERATOR MATCHES "Make" AND CMake_TEST_Fortran)
+  unset(run_BuildDepends_skip_step_3)
+  run_BuildDepends(MakeFortranIncludes)
+  set(run_BuildDepends_skip_step_3 1)
+endif()
+
 if(RunCMake_GENERATOR MATCHES "^Visual Studio 9 " OR
    (RunCMake_GENERATOR MATCHES "Ninja" AND ninja_version VERSION_LESS 1.7))
   # This build tool misses the dependency.
@@ -242,6 +242,61 @@ function(run_TestOutputSize)
 endfunction()
 run_TestOutputSize()
 
+function(run_TestOutputSpool)
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/TestOutputSpool)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  file(REMOVE_RECURSE "${RunCMake_TEST_BINARY_DIR}")
+  file(MAKE_DIRECTORY "${RunCMake_TEST_BINARY_DIR}")
+  # Print far more than the size limits so that most of the output of
+  # each test is spooled to a file.
+  file(WRITE "${RunCMake_TEST_BINARY_DIR}/print.cmake" [[
+foreach(i RANGE 1 200)
+  message("${prefix}Line ${i}")
+endforeach()
+if(prefix STREQUAL "Fail")
+  message(FATAL_ERROR "FailEnd")
+endif()
+]])
+  file(WRITE "${RunCMake_TEST_BINARY_DIR}/CTestTestfile.cmake" "
+  add_test(PassingTest \"${CMAKE_COMMAND}\" -Dprefix=Pass -P print.cmake)
+  add_test(FailingTest \"${CMAKE_COMMAND}\" -Dprefix=Fail -P print.cmake)
+")
+  run_cmake_command(TestOutputSpool
+    ${CMAKE_CTEST_COMMAND} -M Experimental -T Test
+                           --no-compress-output
+                           --output-on-failure
+                           --test-output-size-passed 100
+                           --test-output-size-failed 120
+    )
+endfunction()
+run_TestOutputSpool()
+
+function(run_CriticalPathOrder)
+  set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/CriticalPathOrder)
+  set(RunCMake_TEST_NO_CLEAN 1)
+  file(REMOVE_RECURSE "${RunCMake_TEST_BINARY_DIR}")
+  file(MAKE_DIRECTORY "${RunCMake_TEST_BINARY_DIR}")
+  # Big and Gate are on the same dependency level.  Big costs more by
+  # itself, but the cheap fixture setup Gate holds up a more expensive
+  # chain of tests, so it starts first.
+  file(WRITE "${RunCMake_TEST_BINARY_DIR}/CTestTestfile.cmake" "
+add_test(Big \"${CMAKE_COMMAND}\" -E echo Big)
+add_test(AfterBig1 \"${CMAKE_COMMAND}\" -E echo AfterBig1)
+add_test(AfterBig2 \"${CMAKE_COMMAND}\" -E echo AfterBig2)
+add_test(Gate \"${CMAKE_COMMAND}\" -E echo Gate)
+add_test(Gated1 \"${CMAKE_COMMAND}\" -E echo Gated1)
+add_test(Gated2 \"${CMAKE_COMMAND}\" -E echo Gated2)
+set_tests_properties(Big PROPERTIES COST 15)
+set_tests_properties(AfterBig1 PROPERTIES COST 1 DEPENDS Big)
+set_tests_properties(AfterBig2 PROPERTIES COST 1 DEPENDS AfterBig1)
+set_tests_properties(Gate PROPERTIES COST 1 FIXTURES_SETUP Gate)
+set_tests_properties(Gated1 PROPERTIES COST 10 FIXTURES_REQUIRED Gate)
+set_tests_properties(Gated2 PROPERTIES COST 10 DEPENDS Gated1)
+")
+  run_cmake_command(CriticalPathOrder ${CMAKE_CTEST_COMMAND} -j2)
+endfunction()
+run_CriticalPathOrder()
+
 # Test --stop-on-failure
 function(run_stop_on_failure)
   set(RunCMake_TEST_BINARY_DIR ${RunCMake_BINARY_DIR}/stop-on-failure)
@@ -0,0 +1,47 @@
+file(GLOB test_xml_file "${RunCMake_TEST_BINARY_DIR}/Testing/*/Test.xml")
+if(test_xml_file)
+  file(READ "${test_xml_file}" test_xml)
+  if("${test_xml}" MATCHES [[(<Test Status="passed">.*</Test>).*(<Test Status="failed">.*</Test>)]])
+    set(test_passed "${CMAKE_MATCH_1}")
+    set(test_failed "${CMAKE_MATCH_2}")
+  else()
+    set(RunCMake_TEST_FAILED "Test.xml does not contain a passed then failed test:\n ${test_xml}")
+    return()
+  endif()
+  if(NOT "${test_passed}" MATCHES [[<Value>PassLine 1
+.*100 bytes]] OR "${test_passed}" MATCHES "PassLine 200")
+    set(RunCMake_TEST_FAILED "Test.xml passed test output not truncated at 100 bytes:\n ${test_passed}")
+    return()
+  elseif(NOT "${test_failed}" MATCHES [[<Value>FailLine 1
+.*120 bytes]] OR "${test_failed}" MATCHES "FailLine 200")
+    set(RunCMake_TEST_FAILED "Test.xml failed test output not truncated at 120 bytes:\n ${test_failed}")
+    return()
+  endif()
+else()
+  set(RunCMake_TEST_FAILED "Test.xml not found")
+  return()
+endif()
+
+# The full output of the failed test is printed, including the part
+# that was spooled to a file.
+if(NOT actual_stdout MATCHES "FailLine 1\n.*FailLine 200\n.*FailEnd")
+  set(RunCMake_TEST_FAILED "Full output of failed test not printed:\n ${actual_stdout}")
+  return()
+endif()
+if(actual_stdout MATCHES "PassLine")
+  set(RunCMake_TEST_FAILED "Output of passed test printed:\n ${actual_stdout}")
+  return()
+endif()
+
+# The log keeps the full output of every test.
+file(GLOB last_test_log "${RunCMake_TEST_BINARY_DIR}/Testing/Temporary/LastTest_*.log")
+file(READ "${last_test_log}" last_test)
+if(NOT last_test MATCHES "PassLine 200\n.*FailLine 200\n")
+  set(RunCMake_TEST_FAILED "Full output of tests not logged:\n ${last_test}")
+  return()
+endif()
+
+file(GLOB spool_files "${RunCMake_TEST_BINARY_DIR}/Testing/Temporary/*.spool")
+if(spool_files)
+  set(RunCMake_TEST_FAILED "Spool files not removed:\n ${spool_files}")
+endif()
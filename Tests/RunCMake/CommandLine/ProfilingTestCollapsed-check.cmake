@@ -0,0 +1,12 @@
+if (NOT EXISTS ${ProfilingTestOutput})
+  set(RunCMake_TEST_FAILED "Expected ${ProfilingTestOutput} to exists")
+  return()
+endif()
+
+file(STRINGS ${ProfilingTestOutput} nestedStack
+  REGEX [[^include \(.*CMakeLists\.txt:3\);__testing_command_case \(.*ProfilingTestCollapsed\.cmake:5\);set \(.*ProfilingTestCollapsed\.cmake:2\) [0-9]+$]])
+list(LENGTH nestedStack numStacks)
+if (NOT numStacks EQUAL 1)
+  set(RunCMake_TEST_FAILED
+      "Unexpected number of nested command stacks: ${numStacks}")
+endif()
@@ -0,0 +1,5 @@
+function(__testing_command_case)
+  set(x 1)
+endfunction()
+
+__TESTING_COMMAND_CASE()
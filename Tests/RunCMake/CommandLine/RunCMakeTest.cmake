@@ -803,6 +803,10 @@ set(RunCMake_TEST_OPTIONS --trace-source=trace-only-this-file.cmake)
 run_cmake(trace-source)
 unset(RunCMake_TEST_OPTIONS)
 
+set(RunCMake_TEST_OPTIONS --trace-command=MESSAGE)
+run_cmake(trace-command)
+unset(RunCMake_TEST_OPTIONS)
+
 set(RunCMake_TEST_OPTIONS --debug-trycompile)
 run_cmake(debug-trycompile)
 unset(RunCMake_TEST_OPTIONS)
@@ -898,3 +902,9 @@ set(ProfilingTestOutput ${RunCMake_TEST_BINARY_DIR}/output.json)
 set(RunCMake_TEST_OPTIONS --profiling-format=google-trace --profiling-output=${ProfilingTestOutput})
 run_cmake(ProfilingTest)
 unset(RunCMake_TEST_OPTIONS)
+
+set(RunCMake_TEST_BINARY_DIR "${RunCMake_BINARY_DIR}/profiling-test-collapsed")
+set(ProfilingTestOutput ${RunCMake_TEST_BINARY_DIR}/output.txt)
+set(RunCMake_TEST_OPTIONS --profiling-format=collapsed-stacks --profiling-output=${ProfilingTestOutput})
+run_cmake(ProfilingTestCollapsed)
+unset(RunCMake_TEST_OPTIONS)
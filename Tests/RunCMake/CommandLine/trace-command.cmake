@@ -0,0 +1,3 @@
+set(trace_command_var 1)
+message(STATUS "trace particular command test passed")
+set(trace_command_var 2)
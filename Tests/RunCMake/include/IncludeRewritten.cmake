@@ -0,0 +1,10 @@
+# Rewrite a file with content of the same length between includes, so
+# that only its content tells the two versions apart on filesystems
+# with coarse modification times.
+foreach(v 1 2 3)
+  file(WRITE "${CMAKE_CURRENT_BINARY_DIR}/rewritten.cmake" "set(value ${v})\n")
+  include("${CMAKE_CURRENT_BINARY_DIR}/rewritten.cmake")
+  if(NOT value STREQUAL "${v}")
+    message(FATAL_ERROR "include() of rewritten file set value '${value}', not '${v}'")
+  endif()
+endforeach()
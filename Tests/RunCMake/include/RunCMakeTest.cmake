@@ -7,3 +7,4 @@ run_cmake(CMP0024-NEW)
 run_cmake(ExportExportInclude)
 run_cmake(IncludeIsDirectory)
 run_cmake(IncludeMalformed)
+run_cmake(IncludeRewritten)
@@ -10,3 +10,11 @@ math_test("100 * 10" 1000)
 math_test("100 * 10" 1000 OUTPUT_FORMAT DECIMAL)
 math_test("100 * 0xA" 1000 OUTPUT_FORMAT DECIMAL)
 math_test("100 * 0xA" 0x3e8 OUTPUT_FORMAT HEXADECIMAL)
+math_test("41" 41)
+math_test(" 41 + 1 " 42)
+math_test("1-42" -41)
+math_test("0x10 + 1" 17)
+math_test("010 + 1" 11)
+math_test("999999999999999999 + 999999999999999999" 1999999999999999998)
+math_test("9223372036854775806 + 1" 9223372036854775807)
+math_test("41 + 1" 0x2a OUTPUT_FORMAT HEXADECIMAL)